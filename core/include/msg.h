@@ -167,6 +167,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "cpu_conf.h"
 #include "kernel_types.h"
 
 #ifdef __cplusplus
@@ -180,6 +181,11 @@ extern "C" {
  * The meaning of type and the content fields is totally up to the user,
  * the corresponding fields are never read by the kernel.
  *
+ * With the `core_compact_layout` module, messages are only aligned to
+ * 4 bytes on CPUs that define `CPU_HAS_UNALIGNED_ACCESS`, so they take 12
+ * instead of 16 bytes on 64-bit platforms. Everywhere else, e.g. on 64-bit
+ * RISC-V, a misaligned content.ptr traps or is split into byte accesses, so
+ * messages keep their natural alignment.
  */
 typedef struct {
     kernel_pid_t sender_pid;    /**< PID of sending thread. Will be filled in
@@ -189,7 +195,11 @@ typedef struct {
         void *ptr;              /**< Pointer content field. */
         uint32_t value;         /**< Value content field. */
     } content;                  /**< Content of the message. */
-} msg_t;
+}
+#if defined(MODULE_CORE_COMPACT_LAYOUT) && defined(CPU_HAS_UNALIGNED_ACCESS)
+__attribute__((packed, aligned(4)))
+#endif
+msg_t;
 
 
 /**
@@ -231,6 +241,30 @@ int msg_send(msg_t *m, kernel_pid_t target_pid);
  */
 int msg_try_send(msg_t *m, kernel_pid_t target_pid);
 
+/**
+ * @brief Send a batch of messages to one thread.
+ *
+ * Behaves like calling @ref msg_send() for each message in order, but
+ * delivers as many messages as possible under a single interrupt lock: if
+ * the target is receive blocked, it gets the first message directly and the
+ * following ones are put into its message queue. The target is woken up
+ * once for the whole batch. Only when the queue is full, the sender blocks
+ * as with @ref msg_send() for the next message and continues afterwards.
+ *
+ * If called from an interrupt or for the calling thread itself, this
+ * function will never block and stops at the first message that could not
+ * be delivered.
+ *
+ * @param[in] m             Array of @p num preallocated ``msg_t`` structures
+ * @param[in] num           Number of messages to send
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return number of messages sent, less than @p num if the function must not
+ *         block or the target thread exited while the sender was blocked
+ * @return -1, on error (invalid PID)
+ */
+int msg_send_many(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 
 /**
  * @brief Send a message to the current thread.
@@ -309,6 +343,22 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive up to @p max messages at once.
+ *
+ * Blocks like @ref msg_receive() until at least one message is available,
+ * then takes all queued messages and those of blocked senders, up to
+ * @p max, under a single interrupt lock. Messages are returned in the order
+ * @ref msg_receive() would return them. Woken up senders are scheduled once
+ * after the whole batch has been taken.
+ *
+ * @param[out] buf  Array of at least @p max ``msg_t`` structures
+ * @param[in]  max  Maximum number of messages to receive, must not be 0
+ *
+ * @return  Number of received messages, at least 1
+ */
+int msg_receive_many(msg_t *buf, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
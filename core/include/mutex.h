@@ -11,6 +11,15 @@
  * @defgroup    core_sync_mutex Mutex
  * @ingroup     core_sync
  * @brief       Mutex for thread synchronization
+ *
+ * Waiters are queued by priority. With the `core_mutex_priority_inheritance`
+ * module, the thread holding a mutex additionally runs at the priority of
+ * its highest priority waiter, so medium priority threads can no longer
+ * starve a low priority owner while a high priority thread waits. The boost
+ * is passed on along chains of blocked owners and lasts until the owner has
+ * released all mutexes that have higher priority waiters, so nested locks
+ * can be released in any order. Priorities are only raised while a chain is
+ * blocked, they are not lowered again before the owners unlock.
  * @{
  *
  * @file
@@ -24,34 +33,57 @@
 
 #include <stddef.h>
 
+#include "kernel_types.h"
 #include "list.h"
 
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+struct _thread;
+
 /**
  * @brief Mutex structure. Must never be modified by the user.
  */
-typedef struct {
+typedef struct _mutex {
     /**
      * @brief   The process waiting queue of the mutex. **Must never be changed
      *          by the user.**
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The thread that locked the mutex, KERNEL_PID_UNDEF if unknown
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Next mutex with waiters held by the same owner
+     * @internal
+     */
+    struct _mutex *pi_next;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, NULL }
+#else
 #define MUTEX_INIT { { NULL } }
+#endif
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, NULL }
+#else
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -72,6 +104,10 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+    mutex->pi_next = NULL;
+#endif
 }
 
 /**
@@ -127,6 +163,22 @@ void mutex_unlock(mutex_t *mutex);
  */
 void mutex_unlock_and_sleep(mutex_t *mutex);
 
+/**
+ * @brief Removes a waiting thread from the mutex and wakes it up without
+ *        handing it the mutex
+ *
+ * @internal
+ * Used to implement lock timeouts. With priority inheritance the owner drops
+ * the boost the thread gave it.
+ *
+ * @param[in] mutex     Mutex object the thread waits for, must not be NULL.
+ * @param[in] thread    Thread to remove, must not be NULL.
+ *
+ * @return 1 if the thread was waiting for the mutex and got woken up.
+ * @return 0 if the thread was not waiting for the mutex.
+ */
+int _mutex_remove_waiter(mutex_t *mutex, struct _thread *thread);
+
 #ifdef __cplusplus
 }
 #endif
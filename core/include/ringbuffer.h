@@ -19,12 +19,17 @@
  * @details The ringbuffer is useful for buffering data in the same
  * thread context but it is not thread-safe.  For a thread-safe ring
  * buffer, see @ref sys_tsrb in the System library.
+ *
+ * It is built on the @ref spsc_ring.h "byte ring" and copies data in at
+ * most two spans per call.
  * @}
  */
 
 #ifndef RINGBUFFER_H
 #define RINGBUFFER_H
 
+#include "spsc_ring.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -33,12 +38,7 @@ extern "C" {
  * @brief     Ringbuffer.
  * @details   Non thread-safe FIFO ringbuffer implementation around a `char` array.
  */
-typedef struct {
-    char *buf;          /**< Buffer to operate on. */
-    unsigned int size;  /**< Size of buf. */
-    unsigned int start; /**< Current read position in the ring buffer. */
-    unsigned int avail; /**< Number of elements available for reading. */
-} ringbuffer_t;
+typedef spsc_ring_t ringbuffer_t;
 
 /**
  * @def          RINGBUFFER_INIT(BUF)
@@ -47,7 +47,7 @@ typedef struct {
  * @param[in]    BUF   Buffer to use for the ringbuffer. The size is deduced through `sizeof (BUF)`.
  * @returns      The static initializer.
  */
-#define RINGBUFFER_INIT(BUF) { (BUF), sizeof (BUF), 0, 0 }
+#define RINGBUFFER_INIT(BUF) SPSC_RING_INIT(BUF)
 
 /**
  * @brief        Initialize a ringbuffer.
@@ -57,10 +57,7 @@ typedef struct {
  */
 static inline void ringbuffer_init(ringbuffer_t *__restrict rb, char *buffer, unsigned bufsize)
 {
-    rb->buf = buffer;
-    rb->size = bufsize;
-    rb->start = 0;
-    rb->avail = 0;
+    spsc_ring_init(rb, buffer, bufsize);
 }
 
 /**
@@ -117,7 +114,7 @@ unsigned ringbuffer_remove(ringbuffer_t *__restrict rb, unsigned n);
  */
 static inline int ringbuffer_empty(const ringbuffer_t *__restrict rb)
 {
-    return rb->avail == 0;
+    return spsc_ring_empty(rb);
 }
 
 /**
@@ -127,7 +124,7 @@ static inline int ringbuffer_empty(const ringbuffer_t *__restrict rb)
  */
 static inline int ringbuffer_full(const ringbuffer_t *__restrict rb)
 {
-    return rb->avail == rb->size;
+    return spsc_ring_full(rb);
 }
 
 /**
@@ -137,7 +134,7 @@ static inline int ringbuffer_full(const ringbuffer_t *__restrict rb)
  */
 static inline unsigned int ringbuffer_get_free(const ringbuffer_t *__restrict rb)
 {
-    return rb->size - rb->avail;
+    return spsc_ring_free(rb);
 }
 
 /**
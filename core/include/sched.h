@@ -39,6 +39,16 @@
  * happens, threads with the same priority will only switch due to
  * voluntary or implicit context switches.
  *
+ * ## Earliest Deadline First:
+ *
+ * With the `core_sched_edf` module, periodic threads created by
+ * `thread_create_edf()` of the `sched_edf` module share the priority
+ * @ref THREAD_PRIORITY_EDF. The
+ * run queue of that priority is kept sorted by absolute deadline instead of
+ * arrival, and a thread becoming runnable with an earlier deadline preempts
+ * the running one of the band. Plain threads at that priority queue up
+ * behind all EDF threads.
+ *
  * ## Interrupts:
  *
  * When an interrupt occurs, e.g. because a timer fired or a network
@@ -203,6 +213,18 @@ extern clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];
  */
 NORETURN void sched_task_exit(void);
 
+/**
+ * @brief   Changes the priority of a thread, moving it between run queues
+ *
+ * A runnable thread is queued at the tail of its new priority, the active
+ * thread at the head, so it keeps running unless a switch is requested.
+ * Must be called with interrupts disabled, does not yield.
+ *
+ * @param[in] thread    thread to change
+ * @param[in] priority  new priority
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 #ifdef MODULE_SCHEDSTATISTICS
 /**
  *  Scheduler statistics
@@ -212,6 +234,10 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+#if defined(MODULE_CORE_SCHED_EDF) || defined(DOXYGEN)
+    unsigned int deadline_misses; /**< Jobs of this EDF thread that completed
+                                       after their deadline */
+#endif
 } schedstat_t;
 
 /**
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       Single producer, single consumer byte ring with bulk copy
+ * @details     One producer and one consumer may use the ring concurrently
+ *              without locking, e.g. an ISR and a thread: only the producer
+ *              modifies spsc_ring_t::writes and only the consumer modifies
+ *              spsc_ring_t::reads. Every transfer is split into at most two
+ *              memcpy() calls. Drivers can write into and read from the
+ *              ring memory directly with spsc_ring_reserve() /
+ *              spsc_ring_commit() and spsc_ring_peek() /
+ *              spsc_ring_consume().
+ *
+ *              Both positions run from 0 to twice the size of the buffer,
+ *              which tells a full ring from an empty one without requiring
+ *              the size to be a power of two.
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <assert.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Single producer, single consumer byte ring
+ */
+typedef struct {
+    char *buf;                  /**< Buffer to operate on */
+    unsigned int size;          /**< Size of buf */
+    volatile unsigned reads;    /**< Read position, modulo 2 * size */
+    volatile unsigned writes;   /**< Write position, modulo 2 * size */
+} spsc_ring_t;
+
+/**
+ * @brief   Keeps the compiler from moving buffer accesses across the update of
+ *          a position, which would let the other side see stale data
+ *
+ * @internal
+ */
+#define SPSC_RING_BARRIER() __asm__ volatile ("" : : : "memory")
+
+/**
+ * @brief   Static initializer
+ *
+ * @param[in] BUF   Buffer array to use, its size is taken with sizeof()
+ */
+#define SPSC_RING_INIT(BUF) { (BUF), sizeof (BUF), 0, 0 }
+
+/**
+ * @brief   Initialize a ring
+ *
+ * @param[out] rb       Ring to initialize
+ * @param[in]  buffer   Buffer to use
+ * @param[in]  bufsize  Size of @p buffer, at most UINT_MAX / 2
+ */
+static inline void spsc_ring_init(spsc_ring_t *rb, char *buffer,
+                                  unsigned bufsize)
+{
+    assert(bufsize <= (~0U / 2));
+
+    rb->buf = buffer;
+    rb->size = bufsize;
+    rb->reads = 0;
+    rb->writes = 0;
+}
+
+/**
+ * @brief   Get the number of bytes available for reading
+ *
+ * @param[in] rb    Ring to operate on
+ *
+ * @return  number of bytes available
+ */
+static inline unsigned spsc_ring_avail(const spsc_ring_t *rb)
+{
+    unsigned reads = rb->reads;
+    unsigned writes = rb->writes;
+
+    return (writes >= reads) ? (writes - reads)
+                             : (writes + 2 * rb->size - reads);
+}
+
+/**
+ * @brief   Get the number of bytes that can be written
+ *
+ * @param[in] rb    Ring to operate on
+ *
+ * @return  number of free bytes
+ */
+static inline unsigned spsc_ring_free(const spsc_ring_t *rb)
+{
+    return rb->size - spsc_ring_avail(rb);
+}
+
+/**
+ * @brief   Test if the ring is empty
+ *
+ * @param[in] rb    Ring to operate on
+ *
+ * @return  1 if empty, 0 otherwise
+ */
+static inline int spsc_ring_empty(const spsc_ring_t *rb)
+{
+    return rb->reads == rb->writes;
+}
+
+/**
+ * @brief   Test if the ring is full
+ *
+ * @param[in] rb    Ring to operate on
+ *
+ * @return  1 if full, 0 otherwise
+ */
+static inline int spsc_ring_full(const spsc_ring_t *rb)
+{
+    return spsc_ring_avail(rb) == rb->size;
+}
+
+/**
+ * @brief   Map a position to an index into spsc_ring_t::buf
+ *
+ * @internal
+ */
+static inline unsigned _spsc_ring_index(const spsc_ring_t *rb, unsigned pos)
+{
+    return (pos < rb->size) ? pos : (pos - rb->size);
+}
+
+/**
+ * @brief   Move a position forward by @p n bytes
+ *
+ * @internal
+ */
+static inline unsigned _spsc_ring_advance(const spsc_ring_t *rb, unsigned pos,
+                                          unsigned n)
+{
+    pos += n;
+    return (pos < 2 * rb->size) ? pos : (pos - 2 * rb->size);
+}
+
+/**
+ * @brief   Add a single byte, producer side
+ *
+ * @param[in,out] rb    Ring to operate on
+ * @param[in]     c     Byte to add
+ *
+ * @return  0 on success
+ * @return  -1 if the ring is full
+ */
+static inline int spsc_ring_put_one(spsc_ring_t *rb, char c)
+{
+    unsigned writes = rb->writes;
+
+    if (spsc_ring_full(rb)) {
+        return -1;
+    }
+
+    rb->buf[_spsc_ring_index(rb, writes)] = c;
+    SPSC_RING_BARRIER();
+    rb->writes = _spsc_ring_advance(rb, writes, 1);
+    return 0;
+}
+
+/**
+ * @brief   Take a single byte, consumer side
+ *
+ * @param[in,out] rb    Ring to operate on
+ *
+ * @return  the byte, converted to unsigned char
+ * @return  -1 if the ring is empty
+ */
+static inline int spsc_ring_get_one(spsc_ring_t *rb)
+{
+    unsigned reads = rb->reads;
+
+    if (reads == rb->writes) {
+        return -1;
+    }
+
+    SPSC_RING_BARRIER();
+    int c = (unsigned char)rb->buf[_spsc_ring_index(rb, reads)];
+    SPSC_RING_BARRIER();
+    rb->reads = _spsc_ring_advance(rb, reads, 1);
+    return c;
+}
+
+/**
+ * @brief   Copy up to @p n bytes into the ring, producer side
+ *
+ * @param[in,out] rb    Ring to operate on
+ * @param[in]     src   Data to add
+ * @param[in]     n     Number of bytes to add
+ *
+ * @return  number of bytes added, less than @p n if the ring got full
+ */
+unsigned spsc_ring_write(spsc_ring_t *rb, const void *src, unsigned n);
+
+/**
+ * @brief   Copy up to @p n bytes into the free space of the ring without
+ *          adding them, producer side
+ *
+ * The bytes go @p offset bytes past the write position. They become readable
+ * once the gap before them is written and spsc_ring_commit() moves the write
+ * position over them.
+ *
+ * @param[in,out] rb        Ring to operate on
+ * @param[in]     offset    Distance from the write position
+ * @param[in]     src       Data to copy
+ * @param[in]     n         Number of bytes to copy
+ *
+ * @return  number of bytes copied, less than @p n if they do not fit into the
+ *          free space
+ */
+unsigned spsc_ring_write_ahead(spsc_ring_t *rb, unsigned offset,
+                               const void *src, unsigned n);
+
+/**
+ * @brief   Copy up to @p n bytes out of the ring, consumer side
+ *
+ * @param[in,out] rb    Ring to operate on
+ * @param[out]    dst   Buffer to copy to
+ * @param[in]     n     Maximum number of bytes to take
+ *
+ * @return  number of bytes taken
+ */
+unsigned spsc_ring_read(spsc_ring_t *rb, void *dst, unsigned n);
+
+/**
+ * @brief   Copy up to @p n bytes out of the ring without taking them
+ *
+ * @param[in]  rb   Ring to operate on
+ * @param[out] dst  Buffer to copy to
+ * @param[in]  n    Maximum number of bytes to copy
+ *
+ * @return  number of bytes copied
+ */
+unsigned spsc_ring_copy(const spsc_ring_t *rb, void *dst, unsigned n);
+
+/**
+ * @brief   Get the contiguous free space at the write position, producer
+ *          side
+ *
+ * The caller may write up to @p len bytes to the returned memory and then
+ * make them available with spsc_ring_commit(). As the space ends at the end
+ * of the buffer, a second call after committing may return more space.
+ *
+ * @param[in]  rb   Ring to operate on
+ * @param[out] len  Number of bytes that may be written
+ *
+ * @return  pointer into the ring memory, NULL if the ring is full
+ */
+char *spsc_ring_reserve(spsc_ring_t *rb, unsigned *len);
+
+/**
+ * @brief   Make bytes written to reserved memory available, producer side
+ *
+ * @param[in,out] rb    Ring to operate on
+ * @param[in]     n     Number of bytes written, at most the length returned
+ *                      by the preceding spsc_ring_reserve()
+ */
+void spsc_ring_commit(spsc_ring_t *rb, unsigned n);
+
+/**
+ * @brief   Get the contiguous readable data at the read position, consumer
+ *          side
+ *
+ * The data stays in the ring until it is released with spsc_ring_consume().
+ * As the data ends at the end of the buffer, a second call after consuming
+ * may return more data.
+ *
+ * @param[in]  rb   Ring to operate on
+ * @param[out] len  Number of bytes that may be read
+ *
+ * @return  pointer into the ring memory, NULL if the ring is empty
+ */
+const char *spsc_ring_peek(const spsc_ring_t *rb, unsigned *len);
+
+/**
+ * @brief   Release bytes from the read position, consumer side
+ *
+ * @param[in,out] rb    Ring to operate on
+ * @param[in]     n     Number of bytes to release
+ *
+ * @return  number of bytes released, less than @p n if fewer were available
+ */
+unsigned spsc_ring_consume(spsc_ring_t *rb, unsigned n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSC_RING_H */
+/** @} */
@@ -146,11 +146,25 @@ struct fpu_context;
 
 /**
  * @brief @c thread_t holds thread's context data.
+ *
+ * With the `core_compact_layout` module, the status is stored in a single
+ * byte and small members are moved into the gaps between the pointers,
+ * which removes most of the padding on 64-bit platforms. The run queue entry
+ * and the wait queues still link threads by pointer.
  */
 struct _thread {
     char *sp;                       /**< thread's stack pointer         */
+#ifdef MODULE_CORE_COMPACT_LAYOUT
+    uint8_t status;                 /**< thread's status, a
+                                         @ref thread_status_t           */
+#else
     thread_status_t status;         /**< thread's status                */
+#endif
     uint8_t priority;               /**< thread's priority              */
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+    && defined(MODULE_CORE_COMPACT_LAYOUT)
+    uint8_t base_priority;          /**< priority without inheritance   */
+#endif
 
     kernel_pid_t pid;               /**< thread's process id            */
 
@@ -171,6 +185,10 @@ struct _thread {
                                          (i.e. all blocked sends)       */
     cib_t msg_queue;                /**< index of this [thread's message queue]
                                          (thread_t::msg_array), if any  */
+#if defined(DEVELHELP) && defined(MODULE_CORE_COMPACT_LAYOUT)
+    int stack_size;                 /**< thread's stack size, placed to
+                                         fill the gap after msg_queue   */
+#endif
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
@@ -180,14 +198,34 @@ struct _thread {
 #endif
 #if defined(DEVELHELP) || defined(DOXYGEN)
     const char *name;               /**< thread's name                  */
+#if !defined(MODULE_CORE_MSG) || !defined(MODULE_CORE_COMPACT_LAYOUT)
     int stack_size;                 /**< thread's stack size            */
 #endif
+#endif
 
 //TODO: Move lazy FPU contect to thread arch
 #if defined(USE_LAZY_FPU_CONTEXT)
     struct fpu_context *fpucontext;
 #endif
 
+#if defined(MODULE_CORE_SCHED_EDF) || defined(DOXYGEN)
+    uint32_t edf_period;            /**< job period in us, 0 for threads
+                                         outside the EDF class          */
+    uint32_t edf_rel_deadline;      /**< deadline relative to the job's
+                                         release in us                  */
+    uint32_t edf_release;           /**< release time of the current job */
+    uint32_t edf_deadline;          /**< absolute deadline of the current
+                                         job                            */
+#endif
+
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+#ifndef MODULE_CORE_COMPACT_LAYOUT
+    uint8_t base_priority;          /**< priority without inheritance   */
+#endif
+    struct _mutex *pi_blocked_on;   /**< mutex the thread waits for     */
+    struct _mutex *pi_mutexes;      /**< held mutexes with waiters      */
+#endif
+
 #ifdef HAVE_THREAD_ARCH_T
     thread_arch_t arch;             /**< architecture dependent part    */
 #endif
@@ -298,6 +336,22 @@ struct _thread {
 #define THREAD_PRIORITY_MAIN           (THREAD_PRIORITY_MIN - (SCHED_PRIO_LEVELS/2))
 #endif
 
+/**
+ * @def THREAD_PRIORITY_EDF
+ * @brief Priority band of the earliest deadline first scheduling class
+ *
+ * All threads created by thread_create_edf() of the `sched_edf` module share
+ * this priority. Within the band the runnable thread with the earliest
+ * absolute deadline runs first, the band itself competes with the other
+ * priorities as usual. The default ranks above all threads of the network
+ * stack, which take the priorities from THREAD_PRIORITY_MAIN - 5 up to
+ * THREAD_PRIORITY_MAIN - 1. Plain threads sharing the band would queue
+ * behind the EDF threads.
+ */
+#ifndef THREAD_PRIORITY_EDF
+#define THREAD_PRIORITY_EDF            (THREAD_PRIORITY_MAIN - 6)
+#endif
+
 /**
  * @name Optional flags for controlling a threads initial state
  * @{
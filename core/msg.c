@@ -79,6 +79,69 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     return _msg_send(m, target_pid, false, irq_disable());
 }
 
+int msg_send_many(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("msg_send_many(): target_pid is invalid\n");
+        return -1;
+    }
+
+    bool block = !irq_is_in() && (sched_active_pid != target_pid);
+    unsigned sent = 0;
+
+    while (sent < num) {
+        unsigned state = irq_disable();
+        thread_t *target = (thread_t *) sched_threads[target_pid];
+
+        if (target == NULL) {
+            DEBUG("msg_send_many(): target thread does not exist\n");
+            irq_restore(state);
+            return sent ? (int)sent : -1;
+        }
+
+        kernel_pid_t sender_pid = irq_is_in() ? KERNEL_PID_ISR
+                                              : sched_active_pid;
+        bool woken = false;
+        uint16_t target_prio = target->priority;
+
+        if (target->status == STATUS_RECEIVE_BLOCKED) {
+            DEBUG("msg_send_many(): direct msg copy to %" PRIkernel_pid "\n",
+                  target_pid);
+            m[sent].sender_pid = sender_pid;
+            *((msg_t *) target->wait_data) = m[sent++];
+            sched_set_status(target, STATUS_PENDING);
+            woken = true;
+        }
+
+        /* the target takes the rest from its queue once it runs */
+        while (sent < num) {
+            m[sent].sender_pid = sender_pid;
+            if (!queue_msg(target, &m[sent])) {
+                break;
+            }
+            sent++;
+        }
+
+        if ((sent == num) || !block) {
+            irq_restore(state);
+            if (woken) {
+                /* only switch if the receiver outranks us */
+                sched_switch(target_prio);
+            }
+            return sent;
+        }
+
+        DEBUG("msg_send_many(): queue of %" PRIkernel_pid " is full, "
+              "blocking\n", target_pid);
+        if (_msg_send(&m[sent], target_pid, true, state) != 1) {
+            return sent;
+        }
+        sent++;
+    }
+
+    return sent;
+}
+
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned state)
 {
 #ifdef DEVELHELP
@@ -373,6 +436,87 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/* takes the queued messages and then those of blocked senders into buf,
+ * refilling the queue from the senders once buf is full, the highest
+ * priority of the senders woken up is returned in prio */
+static unsigned _msg_drain(thread_t *me, msg_t *buf, unsigned max,
+                           uint16_t *prio)
+{
+    unsigned n = 0;
+    int index;
+
+    if (thread_has_msg_queue(me)) {
+        while ((n < max) && ((index = cib_get(&(me->msg_queue))) >= 0)) {
+            buf[n++] = me->msg_array[index];
+        }
+    }
+
+    while (me->msg_waiters.next) {
+        msg_t *dest;
+
+        if (n < max) {
+            dest = &buf[n++];
+        }
+        else if (thread_has_msg_queue(me) &&
+                 ((index = cib_put(&(me->msg_queue))) >= 0)) {
+            dest = &me->msg_array[index];
+        }
+        else {
+            break;
+        }
+
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+        thread_t *sender = container_of((clist_node_t*)next, thread_t, rq_entry);
+
+        *dest = *((msg_t*) sender->wait_data);
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < *prio) {
+                *prio = sender->priority;
+            }
+        }
+    }
+
+    return n;
+}
+
+int msg_receive_many(msg_t *buf, unsigned max)
+{
+    assert(max > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = (thread_t*) sched_threads[sched_active_pid];
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned n = _msg_drain(me, buf, max, &sender_prio);
+
+    if (n == 0) {
+        DEBUG("msg_receive_many(): %" PRIkernel_pid ": No msg. Going "
+              "blocked.\n", sched_active_pid);
+        me->wait_data = (void *) buf;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* the sender copied the first message, take what was queued after
+         * it, checking without the lock first to save a locked section in
+         * the common one message case */
+        n = 1;
+        if ((max == 1) || (!cib_avail(&(me->msg_queue)) &&
+                           !me->msg_waiters.next)) {
+            return n;
+        }
+        state = irq_disable();
+        n += _msg_drain(me, buf + 1, max - 1, &sender_prio);
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return n;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
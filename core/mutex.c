@@ -32,6 +32,138 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+/* changes a thread's priority, keeping the wait queue it blocks in sorted */
+static void _pi_set_priority(thread_t *thread, uint8_t priority)
+{
+    mutex_t *blocked_on = thread->pi_blocked_on;
+
+    if (blocked_on && (thread->status == STATUS_MUTEX_BLOCKED)) {
+        list_remove(&blocked_on->queue, (list_node_t *)&thread->rq_entry);
+        thread->priority = priority;
+        thread_add_to_list(&blocked_on->queue, thread);
+    }
+    else {
+        sched_change_priority(thread, priority);
+    }
+}
+
+/* raises the owner of a mutex to priority and passes the boost on along a
+ * chain of owners that are blocked themselves, hops are bounded in case of
+ * a deadlock cycle */
+static void _pi_boost(mutex_t *mutex, uint8_t priority)
+{
+    for (unsigned hops = 0; mutex && (hops < KERNEL_PID_LAST); hops++) {
+        thread_t *owner = (thread_t *)thread_get(mutex->owner);
+        if (!owner || (owner->priority <= priority)) {
+            return;
+        }
+        DEBUG("mutex: boosting PID[%" PRIkernel_pid "] to prio %u\n",
+              owner->pid, (unsigned)priority);
+        _pi_set_priority(owner, priority);
+        mutex = owner->pi_blocked_on;
+    }
+}
+
+static void _pi_link(thread_t *owner, mutex_t *mutex)
+{
+    for (mutex_t *m = owner->pi_mutexes; m; m = m->pi_next) {
+        if (m == mutex) {
+            return;
+        }
+    }
+    mutex->pi_next = owner->pi_mutexes;
+    owner->pi_mutexes = mutex;
+}
+
+static void _pi_unlink(thread_t *owner, mutex_t *mutex)
+{
+    for (mutex_t **m = &owner->pi_mutexes; *m; m = &(*m)->pi_next) {
+        if (*m == mutex) {
+            *m = mutex->pi_next;
+            return;
+        }
+    }
+}
+
+/* drops a thread to the highest priority of the waiters of the mutexes it
+ * still holds, or its own, returns 1 if the priority was lowered */
+static int _pi_restore(thread_t *thread)
+{
+    uint8_t priority = thread->base_priority;
+
+    for (mutex_t *m = thread->pi_mutexes; m; m = m->pi_next) {
+        if ((m->queue.next == NULL) || (m->queue.next == MUTEX_LOCKED)) {
+            continue;
+        }
+        thread_t *waiter = container_of((clist_node_t *)m->queue.next,
+                                        thread_t, rq_entry);
+        if (waiter->priority < priority) {
+            priority = waiter->priority;
+        }
+    }
+
+    if (priority <= thread->priority) {
+        return 0;
+    }
+
+    DEBUG("mutex: restoring PID[%" PRIkernel_pid "] to prio %u\n",
+          thread->pid, (unsigned)priority);
+    _pi_set_priority(thread, priority);
+    return 1;
+}
+
+/* makes next, already removed from the wait queue, the owner of the mutex */
+static int _pi_handoff(mutex_t *mutex, thread_t *next)
+{
+    thread_t *owner = (thread_t *)thread_get(mutex->owner);
+
+    if (owner) {
+        _pi_unlink(owner, mutex);
+    }
+
+    mutex->owner = next->pid;
+    next->pi_blocked_on = NULL;
+    if (mutex->queue.next != MUTEX_LOCKED) {
+        _pi_link(next, mutex);
+    }
+
+    return owner ? _pi_restore(owner) : 0;
+}
+
+/* the mutex was unlocked without waiters, drops what is left of the owner's
+ * boost in case the last waiter gave up */
+static int _pi_release(mutex_t *mutex)
+{
+    thread_t *owner = (thread_t *)thread_get(mutex->owner);
+
+    mutex->owner = KERNEL_PID_UNDEF;
+    if (!owner) {
+        return 0;
+    }
+
+    _pi_unlink(owner, mutex);
+    return _pi_restore(owner);
+}
+
+/* thread, already removed from the wait queue, stopped waiting without
+ * getting the mutex */
+static void _pi_cancel(mutex_t *mutex, thread_t *thread)
+{
+    thread_t *owner = (thread_t *)thread_get(mutex->owner);
+
+    thread->pi_blocked_on = NULL;
+    if (!owner) {
+        return;
+    }
+
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        _pi_unlink(owner, mutex);
+    }
+    _pi_restore(owner);
+}
+#endif
+
 int _mutex_lock(mutex_t *mutex, int blocking)
 {
     unsigned irqstate = irq_disable();
@@ -41,6 +173,9 @@ int _mutex_lock(mutex_t *mutex, int blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        mutex->owner = irq_is_in() ? KERNEL_PID_UNDEF : sched_active_pid;
+#endif
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               sched_active_pid);
         irq_restore(irqstate);
@@ -58,6 +193,14 @@ int _mutex_lock(mutex_t *mutex, int blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        me->pi_blocked_on = mutex;
+        thread_t *owner = (thread_t *)thread_get(mutex->owner);
+        if (owner && (owner != me)) {
+            _pi_link(owner, mutex);
+            _pi_boost(mutex, me->priority);
+        }
+#endif
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
@@ -85,6 +228,13 @@ void mutex_unlock(mutex_t *mutex)
 
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        if (_pi_release(mutex)) {
+            irq_restore(irqstate);
+            thread_yield_higher();
+            return;
+        }
+#endif
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
         return;
@@ -102,11 +252,44 @@ void mutex_unlock(mutex_t *mutex)
         mutex->queue.next = MUTEX_LOCKED;
     }
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    if (_pi_handoff(mutex, process)) {
+        /* the old owner lost its boost, anything may preempt it now */
+        irq_restore(irqstate);
+        thread_yield_higher();
+        return;
+    }
+#endif
+
     uint16_t process_priority = process->priority;
     irq_restore(irqstate);
     sched_switch(process_priority);
 }
 
+int _mutex_remove_waiter(mutex_t *mutex, thread_t *thread)
+{
+    unsigned irqstate = irq_disable();
+
+    if ((mutex->queue.next == NULL) || (mutex->queue.next == MUTEX_LOCKED) ||
+        !list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
+        /* the thread got the mutex already or never waited for it */
+        irq_restore(irqstate);
+        return 0;
+    }
+
+    DEBUG("PID[%" PRIkernel_pid "]: stops waiting for mutex.\n", thread->pid);
+    if (mutex->queue.next == NULL) {
+        mutex->queue.next = MUTEX_LOCKED;
+    }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    _pi_cancel(mutex, thread);
+#endif
+    sched_set_status(thread, STATUS_PENDING);
+
+    irq_restore(irqstate);
+    return 1;
+}
+
 void mutex_unlock_and_sleep(mutex_t *mutex)
 {
     DEBUG("PID[%" PRIkernel_pid "]: unlocking mutex. queue.next: %p, and "
@@ -116,6 +299,9 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     if (mutex->queue.next) {
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            _pi_release(mutex);
+#endif
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -126,6 +312,9 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            _pi_handoff(mutex, process);
+#endif
         }
     }
 
@@ -37,6 +37,10 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+#include "sched_round_robin.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -79,6 +83,37 @@ static void (*sched_cb) (uint32_t timestamp, uint32_t value) = NULL;
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 #endif
 
+#ifdef MODULE_CORE_SCHED_EDF
+/* wrap around safe deadline order, threads outside the EDF class go last */
+static inline int _edf_before(const thread_t *a, const thread_t *b)
+{
+    if (!a->edf_period || !b->edf_period) {
+        return a->edf_period && !b->edf_period;
+    }
+    return (int32_t)(a->edf_deadline - b->edf_deadline) < 0;
+}
+
+/* inserts behind all threads due no later, so equal deadlines stay FIFO */
+static void _edf_insert(clist_node_t *rq, thread_t *thread)
+{
+    clist_node_t *last = rq->next;
+    clist_node_t *prev = last;
+
+    if (last) {
+        do {
+            clist_node_t *node = prev->next;
+            if (_edf_before(thread, container_of(node, thread_t, rq_entry))) {
+                thread->rq_entry.next = node;
+                prev->next = &thread->rq_entry;
+                return;
+            }
+            prev = node;
+        } while (prev != last);
+    }
+    clist_rpush(rq, &thread->rq_entry);
+}
+#endif
+
 int __attribute__((used)) sched_run(void)
 {
     sched_context_switch_request = 0;
@@ -97,6 +132,9 @@ int __attribute__((used)) sched_run(void)
 
     if (active_thread == next_thread) {
         DEBUG("sched_run: done, sched_active_thread was not changed.\n");
+#ifdef MODULE_SCHED_ROUND_ROBIN
+        sched_round_robin_update();
+#endif
         return 0;
     }
 
@@ -146,6 +184,10 @@ int __attribute__((used)) sched_run(void)
     mpu_enable();
 #endif
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    sched_round_robin_update();
+#endif
+
     DEBUG("sched_run: done, changed sched_active_thread.\n");
 
     return 1;
@@ -164,7 +206,15 @@ void sched_set_status(thread_t *process, thread_status_t status)
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             DEBUG("sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu8 ".\n",
                   process->pid, process->priority);
-            clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
+#ifdef MODULE_CORE_SCHED_EDF
+            if (process->priority == THREAD_PRIORITY_EDF) {
+                _edf_insert(&sched_runqueues[process->priority], process);
+            }
+            else
+#endif
+            {
+                clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
+            }
             runqueue_bitcache |= 1 << process->priority;
         }
     }
@@ -172,7 +222,16 @@ void sched_set_status(thread_t *process, thread_status_t status)
         if (process->status >= STATUS_ON_RUNQUEUE) {
             DEBUG("sched_set_status: removing thread %" PRIkernel_pid " from runqueue %" PRIu8 ".\n",
                   process->pid, process->priority);
-            clist_lpop(&sched_runqueues[process->priority]);
+#ifdef MODULE_CORE_SCHED_EDF
+            /* a preempted EDF thread may block before it got to the head */
+            if (process->priority == THREAD_PRIORITY_EDF) {
+                clist_remove(&sched_runqueues[process->priority], &(process->rq_entry));
+            }
+            else
+#endif
+            {
+                clist_lpop(&sched_runqueues[process->priority]);
+            }
 
             if (!sched_runqueues[process->priority].next) {
                 runqueue_bitcache &= ~(1 << process->priority);
@@ -181,6 +240,49 @@ void sched_set_status(thread_t *process, thread_status_t status)
     }
 
     process->status = status;
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    sched_round_robin_update();
+#endif
+}
+
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    uint8_t old_priority = thread->priority;
+
+    if (old_priority == priority) {
+        return;
+    }
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[old_priority], &thread->rq_entry);
+        if (!sched_runqueues[old_priority].next) {
+            runqueue_bitcache &= ~(1 << old_priority);
+        }
+
+        thread->priority = priority;
+
+#ifdef MODULE_CORE_SCHED_EDF
+        if (priority == THREAD_PRIORITY_EDF) {
+            _edf_insert(&sched_runqueues[priority], thread);
+        }
+        else
+#endif
+        if (thread == sched_active_thread) {
+            clist_lpush(&sched_runqueues[priority], &thread->rq_entry);
+        }
+        else {
+            clist_rpush(&sched_runqueues[priority], &thread->rq_entry);
+        }
+        runqueue_bitcache |= 1 << priority;
+    }
+    else {
+        thread->priority = priority;
+    }
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    sched_round_robin_update();
+#endif
 }
 
 void sched_switch(uint16_t other_prio)
@@ -193,7 +295,18 @@ void sched_switch(uint16_t other_prio)
           ", other_prio=%" PRIu16 "\n",
           active_thread->pid, current_prio, on_runqueue, other_prio);
 
-    if (!on_runqueue || (current_prio > other_prio)) {
+    int preempt = !on_runqueue || (current_prio > other_prio);
+
+#ifdef MODULE_CORE_SCHED_EDF
+    /* within the EDF band an earlier deadline preempts, which shows as a
+     * different thread at the head of the sorted run queue */
+    if ((current_prio == other_prio) && (current_prio == THREAD_PRIORITY_EDF)
+        && (clist_lpeek(&sched_runqueues[current_prio]) != &active_thread->rq_entry)) {
+        preempt = 1;
+    }
+#endif
+
+    if (preempt) {
         if (irq_is_in()) {
             DEBUG("sched_switch: setting sched_context_switch_request.\n");
             sched_context_switch_request = 1;
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_util
+ * @{
+ *
+ * @file
+ * @brief       Single producer, single consumer byte ring implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "spsc_ring.h"
+
+unsigned spsc_ring_write_ahead(spsc_ring_t *rb, unsigned offset,
+                               const void *src, unsigned n)
+{
+    unsigned space = spsc_ring_free(rb);
+
+    if (offset >= space) {
+        return 0;
+    }
+    if (n > space - offset) {
+        n = space - offset;
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    unsigned idx = _spsc_ring_index(rb, _spsc_ring_advance(rb, rb->writes,
+                                                           offset));
+    unsigned first = rb->size - idx;
+
+    if (first >= n) {
+        memcpy(rb->buf + idx, src, n);
+    }
+    else {
+        memcpy(rb->buf + idx, src, first);
+        memcpy(rb->buf, (const char *)src + first, n - first);
+    }
+    return n;
+}
+
+unsigned spsc_ring_write(spsc_ring_t *rb, const void *src, unsigned n)
+{
+    n = spsc_ring_write_ahead(rb, 0, src, n);
+    if (n) {
+        SPSC_RING_BARRIER();
+        rb->writes = _spsc_ring_advance(rb, rb->writes, n);
+    }
+    return n;
+}
+
+unsigned spsc_ring_copy(const spsc_ring_t *rb, void *dst, unsigned n)
+{
+    unsigned avail = spsc_ring_avail(rb);
+
+    if (n > avail) {
+        n = avail;
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    SPSC_RING_BARRIER();
+    unsigned idx = _spsc_ring_index(rb, rb->reads);
+    unsigned first = rb->size - idx;
+
+    if (first >= n) {
+        memcpy(dst, rb->buf + idx, n);
+    }
+    else {
+        memcpy(dst, rb->buf + idx, first);
+        memcpy((char *)dst + first, rb->buf, n - first);
+    }
+    return n;
+}
+
+unsigned spsc_ring_read(spsc_ring_t *rb, void *dst, unsigned n)
+{
+    n = spsc_ring_copy(rb, dst, n);
+    if (n) {
+        SPSC_RING_BARRIER();
+        rb->reads = _spsc_ring_advance(rb, rb->reads, n);
+    }
+    return n;
+}
+
+char *spsc_ring_reserve(spsc_ring_t *rb, unsigned *len)
+{
+    unsigned space = spsc_ring_free(rb);
+    unsigned idx = _spsc_ring_index(rb, rb->writes);
+    unsigned contiguous = rb->size - idx;
+
+    *len = (space < contiguous) ? space : contiguous;
+    return *len ? (rb->buf + idx) : NULL;
+}
+
+void spsc_ring_commit(spsc_ring_t *rb, unsigned n)
+{
+    assert(n <= spsc_ring_free(rb));
+
+    SPSC_RING_BARRIER();
+    rb->writes = _spsc_ring_advance(rb, rb->writes, n);
+}
+
+const char *spsc_ring_peek(const spsc_ring_t *rb, unsigned *len)
+{
+    unsigned avail = spsc_ring_avail(rb);
+    unsigned idx = _spsc_ring_index(rb, rb->reads);
+    unsigned contiguous = rb->size - idx;
+
+    *len = (avail < contiguous) ? avail : contiguous;
+    SPSC_RING_BARRIER();
+    return *len ? (rb->buf + idx) : NULL;
+}
+
+unsigned spsc_ring_consume(spsc_ring_t *rb, unsigned n)
+{
+    unsigned avail = spsc_ring_avail(rb);
+
+    if (n > avail) {
+        n = avail;
+    }
+    SPSC_RING_BARRIER();
+    rb->reads = _spsc_ring_advance(rb, rb->reads, n);
+    return n;
+}
@@ -101,7 +101,12 @@ void thread_yield(void)
 {
     unsigned old_state = irq_disable();
     thread_t *me = (thread_t *)sched_active_thread;
-    if (me != NULL && me->status >= STATUS_ON_RUNQUEUE) {
+    if (me != NULL && me->status >= STATUS_ON_RUNQUEUE
+#ifdef MODULE_CORE_SCHED_EDF
+        /* the EDF run queue stays in deadline order */
+        && me->priority != THREAD_PRIORITY_EDF
+#endif
+        ) {
         clist_lpoprpush(&sched_runqueues[me->priority]);
     }
     irq_restore(old_state);
@@ -231,6 +236,16 @@ kernel_pid_t thread_create_with_fp(char *stack, int stacksize, struct fpu_contex
 
     thread->rq_entry.next = NULL;
 
+#ifdef MODULE_CORE_SCHED_EDF
+    thread->edf_period = 0;
+#endif
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+    thread->pi_blocked_on = NULL;
+    thread->pi_mutexes = NULL;
+#endif
+
 #ifdef MODULE_CORE_MSG
     thread->wait_data = NULL;
     thread->msg_waiters.next = NULL;
@@ -22,6 +22,10 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
+#ifdef __linux__
+#include <stdint.h>
+#include <sys/epoll.h>
+#endif
 
 #include "async_read.h"
 #include "native_internal.h"
@@ -36,6 +40,89 @@ static pid_t _sigio_child_pids[ASYNC_READ_NUMOF];
 static void _sigio_child(int fd);
 #endif
 
+#ifdef __linux__
+_Static_assert(ASYNC_READ_NUMOF <= 32, "ready mask only holds 32 descriptors");
+
+static int _epoll_fd = -1;
+static unsigned long _io_thread;
+static unsigned long _riot_thread;
+/* descriptors reported readable by the I/O thread and not yet handled */
+static uint32_t _ready;
+#endif
+
+#ifdef __linux__
+/*
+ * The I/O thread is a host thread with all signals blocked. It only waits on
+ * the epoll instance and sends a single SIGIO to RIOT's thread when the first
+ * descriptor of a batch becomes ready. All descriptors are registered with
+ * EPOLLONESHOT, so a descriptor is only reported again after
+ * native_async_read_continue() re-armed it.
+ */
+static void *_io_thread_func(void *arg)
+{
+    (void)arg;
+    struct epoll_event events[ASYNC_READ_NUMOF];
+
+    while (1) {
+        int n = real_epoll_wait(_epoll_fd, events, ASYNC_READ_NUMOF, -1);
+        uint32_t mask = 0;
+
+        for (int i = 0; i < n; i++) {
+            mask |= (1UL << events[i].data.u32);
+        }
+        if (mask && (__atomic_fetch_or(&_ready, mask, __ATOMIC_ACQ_REL) == 0)) {
+            real_pthread_kill(_riot_thread, SIGIO);
+        }
+    }
+
+    return NULL;
+}
+
+static void _arm(int i)
+{
+    struct epoll_event ev = {
+        .events = EPOLLIN | EPOLLONESHOT,
+        .data.u32 = i,
+    };
+
+    if (real_epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, _fds[i], &ev) == -1) {
+        err(EXIT_FAILURE, "native_async_read: epoll_ctl(EPOLL_CTL_MOD)");
+    }
+}
+
+static void _async_io_isr(void)
+{
+    uint32_t ready = __atomic_exchange_n(&_ready, 0, __ATOMIC_ACQ_REL);
+
+    for (int i = 0; ready; i++, ready >>= 1) {
+        if (ready & 1) {
+            _native_async_read_callbacks[i](_fds[i], _args[i]);
+        }
+    }
+}
+
+static void _start_io_thread(void)
+{
+    sigset_t all, old;
+
+    _native_syscall_enter();
+
+    if ((_epoll_fd = real_epoll_create1(EPOLL_CLOEXEC)) == -1) {
+        err(EXIT_FAILURE, "native_async_read_setup(): epoll_create1");
+    }
+
+    /* the I/O thread must never handle any of RIOT's signals */
+    sigfillset(&all);
+    sigprocmask(SIG_SETMASK, &all, &old);
+    _riot_thread = real_pthread_self();
+    if (real_pthread_create(&_io_thread, NULL, _io_thread_func, NULL) != 0) {
+        errx(EXIT_FAILURE, "native_async_read_setup(): pthread_create");
+    }
+    sigprocmask(SIG_SETMASK, &old, NULL);
+
+    _native_syscall_leave();
+}
+#else
 static void _async_io_isr(void) {
     fd_set rfds;
 
@@ -61,8 +148,14 @@ static void _async_io_isr(void) {
         }
     }
 }
+#endif /* __linux__ */
 
 void native_async_read_setup(void) {
+#ifdef __linux__
+    if (_epoll_fd == -1) {
+        _start_io_thread();
+    }
+#endif
     register_interrupt(SIGIO, _async_io_isr);
 }
 
@@ -75,14 +168,22 @@ void native_async_read_cleanup(void) {
 #endif
         real_close(_fds[i]);
     }
+#ifdef __linux__
+    /* closing removed the descriptors from the epoll set */
+    __atomic_store_n(&_ready, 0, __ATOMIC_RELEASE);
+#endif
 }
 
 void native_async_read_continue(int fd) {
     (void) fd;
-#ifdef __MACH__
+#if defined(__MACH__) || defined(__linux__)
     for (int i = 0; i < _next_index; i++) {
         if (_fds[i] == fd) {
+#ifdef __MACH__
             kill(_sigio_child_pids[i], SIGCONT);
+#else
+            _arm(i);
+#endif
         }
     }
 #endif
@@ -101,6 +202,20 @@ void native_async_read_add_handler(int fd, void *arg, native_async_read_callback
     /* tuntap signalled IO is not working in OSX,
      * * check http://sourceforge.net/p/tuntaposx/bugs/17/ */
     _sigio_child(_next_index);
+#elif defined(__linux__)
+    /* set file access mode to non-blocking, readiness is reported by the I/O
+     * thread instead of O_ASYNC */
+    if (real_fcntl(fd, F_SETFL, O_NONBLOCK) == -1) {
+        err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETFL)");
+    }
+
+    struct epoll_event ev = {
+        .events = EPOLLIN | EPOLLONESHOT,
+        .data.u32 = _next_index,
+    };
+    if (real_epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+        err(EXIT_FAILURE, "native_async_read_add_handler(): epoll_ctl(EPOLL_CTL_ADD)");
+    }
 #else
     /* configure fds to send signals on io */
     if (real_fcntl(fd, F_SETOWN, _native_pid) == -1) {
@@ -37,7 +37,9 @@ typedef void (*native_async_read_callback_t)(int fd, void *arg);
 /**
  * @brief   initialize asynchronus read system
  *
- * This registers SIGIO signal handler.
+ * This registers SIGIO signal handler. On Linux, this also starts a host
+ * thread that waits for all monitored file descriptors using epoll(7) and
+ * raises one SIGIO for any number of descriptors becoming readable.
  */
 void native_async_read_setup(void);
 
@@ -51,7 +53,10 @@ void native_async_read_cleanup(void);
 /**
  * @brief   resume monitoring of file descriptors
  *
- * Call this function after reading file descriptors.
+ * Call this function after reading file descriptors. A descriptor is not
+ * reported again before this is called (except on platforms without
+ * reliable SIGIO, where readiness is signalled on new data only). Calling it
+ * while data is still pending leads to another interrupt.
  *
  * @param[in] fd  The file descriptor to monitor
  */
@@ -55,6 +55,33 @@ extern "C" {
  */
 #define NATIVE_ETH_PROTO 0x1234
 
+/**
+ * @brief   Switch threads yielding from thread context with the hand-written
+ *          context switch in tramp.S
+ *
+ * Only the callee-saved registers are stored on the yielding thread's stack,
+ * the signal mask is left untouched. Threads preempted by a signal are still
+ * saved and resumed through ucontext. Only available on x86-64 Linux, set to
+ * 0 to always switch via swapcontext(3).
+ */
+#ifndef NATIVE_CTX_SWITCH_ASM
+#if defined(__x86_64__) && defined(__linux__)
+#define NATIVE_CTX_SWITCH_ASM   (1)
+#else
+#define NATIVE_CTX_SWITCH_ASM   (0)
+#endif
+#endif
+
+/**
+ * @brief   The host CPU handles misaligned loads and stores in hardware at
+ *          little or no cost
+ *
+ * Lets `core_compact_layout` pack msg_t on 64-bit hosts.
+ */
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+#define CPU_HAS_UNALIGNED_ACCESS
+#endif
+
 #if (defined(GNRC_PKTBUF_SIZE)) && (GNRC_PKTBUF_SIZE < 2048)
 #   undef  GNRC_PKTBUF_SIZE
 #   define GNRC_PKTBUF_SIZE     (2048)
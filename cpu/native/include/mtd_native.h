@@ -12,6 +12,15 @@
  * @{
  * @brief       mtd flash emulation for native
  *
+ * The flash is emulated by a file on the host. NOR flash semantics apply:
+ * erasing sets all bytes of a sector to 0xff, writing can only clear bits.
+ *
+ * By default, the file is opened and accessed with stdio on every operation.
+ * With the `mtd_native_mmap` module, the file is mapped into memory once on
+ * init and all operations are served from the mapping. Changes are written
+ * back by the host's page cache, MTD_POWER_DOWN forces this with msync(2)
+ * (unless MTD_NATIVE_MMAP_SYNC is 0).
+ *
  * @file
  *
  * @author      Vincent Dupont <vincent@otakeys.com>
@@ -24,12 +33,39 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
 #include "mtd.h"
 
+/**
+ * @brief   Flush the mapped image to the file on MTD_POWER_DOWN
+ */
+#ifndef MTD_NATIVE_MMAP_SYNC
+#define MTD_NATIVE_MMAP_SYNC    (1)
+#endif
+
+/**
+ * @brief   Operation statistics of a native mtd device
+ */
+typedef struct {
+    uint32_t reads;             /**< number of read operations */
+    uint32_t writes;            /**< number of write operations */
+    uint32_t erases;            /**< number of erase operations */
+    uint64_t read_bytes;        /**< number of bytes read */
+    uint64_t write_bytes;       /**< number of bytes written */
+    uint64_t erase_bytes;       /**< number of bytes erased */
+    uint32_t *sector_erases;    /**< number of erases per sector, allocated
+                                     on init */
+} mtd_native_stats_t;
+
 /** mtd native descriptor */
 typedef struct mtd_native_dev {
     mtd_dev_t dev;      /**< mtd generic device */
     const char *fname;  /**< filename to use for memory emulation */
+    mtd_native_stats_t stats;   /**< operation statistics */
+#if defined(MODULE_MTD_NATIVE_MMAP) || defined(DOXYGEN)
+    uint8_t *mem;       /**< mapping of the file */
+#endif
 } mtd_native_dev_t;
 
 /**
@@ -37,6 +73,13 @@ typedef struct mtd_native_dev {
  */
 extern const mtd_desc_t native_flash_driver;
 
+/**
+ * @brief   Reset the operation statistics of a native mtd device
+ *
+ * @param[in] dev   the device, must be initialized
+ */
+void mtd_native_stats_reset(mtd_native_dev_t *dev);
+
 #ifdef __cplusplus
 }
 #endif
@@ -53,6 +53,7 @@
 #include <sys/stat.h>
 #include <sys/uio.h>
 
+#include "cpu_conf.h"
 #include "kernel_types.h"
 
 #ifdef __cplusplus
@@ -74,6 +75,13 @@ void native_interrupt_init(void);
 void native_irq_handler(void);
 extern void _native_sig_leave_tramp(void);
 extern void _native_sig_leave_handler(void);
+#if NATIVE_CTX_SWITCH_ASM
+extern void _native_ctx_switch(greg_t *from, greg_t *to, ucontext_t *to_full);
+extern void _native_ctx_resume(void);
+void _native_ctx_resume_full(ucontext_t *ctx);
+void _native_ctx_set_sigmask(ucontext_t *ctx);
+void _native_fast_sched_run(void);
+#endif
 
 void _native_syscall_leave(void);
 void _native_syscall_enter(void);
@@ -102,6 +110,7 @@ extern int (*real_connect)(int socket, ...);
 extern int (*real_chdir)(const char *path);
 extern int (*real_close)(int);
 extern int (*real_fcntl)(int, int, ...);
+extern int (*real_ftruncate)(int fd, off_t length);
 /* The ... is a hack to save includes: */
 extern int (*real_creat)(const char *path, ...);
 extern int (*real_dup2)(int, int);
@@ -116,6 +125,10 @@ extern int (*real_getpid)(void);
 extern int (*real_gettimeofday)(struct timeval *t, ...);
 extern int (*real_ioctl)(int fildes, int request, ...);
 extern int (*real_listen)(int socket, int backlog);
+extern off_t (*real_lseek)(int fd, off_t offset, int whence);
+extern void* (*real_mmap)(void *addr, size_t length, int prot, int flags,
+                          int fd, off_t offset);
+extern int (*real_msync)(void *addr, size_t length, int flags);
 extern int (*real_open)(const char *path, int oflag, ...);
 extern int (*real_pause)(void);
 extern int (*real_pipe)(int[2]);
@@ -142,6 +155,19 @@ extern ssize_t (*real_writev)(int fildes, const struct iovec *iov, int iovcnt);
 #else
 extern int (*real_clock_gettime)(clockid_t clk_id, struct timespec *tp);
 #endif
+#ifdef __linux__
+struct epoll_event;
+extern int (*real_epoll_create1)(int flags);
+extern int (*real_epoll_ctl)(int epfd, int op, int fd, struct epoll_event *event);
+extern int (*real_epoll_wait)(int epfd, struct epoll_event *events,
+                              int maxevents, int timeout);
+/* host threads, pthread_t is an unsigned long with glibc. RIOT's pthread
+ * module defines pthread_create() and pthread_self() itself */
+extern int (*real_pthread_create)(unsigned long *thread, const void *attr,
+                                  void *(*start_routine)(void *), void *arg);
+extern int (*real_pthread_kill)(unsigned long thread, int sig);
+extern unsigned long (*real_pthread_self)(void);
+#endif
 
 /**
  * data structures
@@ -167,6 +193,18 @@ extern unsigned _native_rng_seed;
 extern int _native_rng_mode; /**< 0 = /dev/random, 1 = random(3) */
 extern const char *_native_unix_socket_path;
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+/**
+ * @brief   Advance the clock to the armed timer deadline and pend its expiry
+ *
+ * Must be called with all signals blocked.
+ *
+ * @return  1 if a timer expiry was pended, 0 if no timer is armed or the host
+ *          timer expired already and its SIGALRM is pending
+ */
+int _native_timer_skip(void);
+#endif
+
 ssize_t _native_read(int fd, void *buf, size_t count);
 ssize_t _native_write(int fd, const void *buf, size_t count);
 ssize_t _native_writev(int fildes, const struct iovec *iov, int iovcnt);
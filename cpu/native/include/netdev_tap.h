@@ -29,6 +29,7 @@ extern "C" {
 #include <stdint.h>
 #include "net/netdev.h"
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 
 #ifdef __MACH__
@@ -37,6 +38,19 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames handed to the stack per interrupt
+ *
+ * All frames pending on the TAP are read in one go after a single SIGIO, up
+ * to this number. Remaining frames trigger another interrupt, so that the
+ * network stack may process other events in between. Frames are passed on
+ * without waiting for the upper layers, so larger values only pay off with
+ * accordingly larger message queues there (e.g. GNRC_IPV6_MSG_QUEUE_SIZE).
+ */
+#ifndef NETDEV_TAP_RX_BUDGET
+#define NETDEV_TAP_RX_BUDGET    (8U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -46,6 +60,8 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscous;                 /**< Flag for promiscous mode */
+    uint16_t rx_len;                    /**< length of the frame in rx_buf */
+    uint8_t rx_buf[ETHERNET_FRAME_LEN]; /**< frame currently being received */
 } netdev_tap_t;
 
 /**
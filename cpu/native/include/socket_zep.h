@@ -23,6 +23,8 @@
 #ifndef SOCKET_ZEP_H
 #define SOCKET_ZEP_H
 
+#include <stdbool.h>
+
 #include "net/netdev.h"
 #include "net/netdev/ieee802154.h"
 #include "net/zep.h"
@@ -38,6 +40,7 @@ typedef struct {
     netdev_ieee802154_t netdev;     /**< netdev internal member */
     int sock_fd;                    /**< socket fd */
     netdev_event_t last_event;      /**< event triggered */
+    bool rx_pending;                /**< socket became readable */
     uint32_t seq;                   /**< ZEP sequence number */
     /**
      * @brief   Receive buffer
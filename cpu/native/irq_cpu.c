@@ -52,6 +52,11 @@ volatile int _native_in_syscall;
 
 static sigset_t _native_sig_set, _native_sig_set_dint;
 
+#if NATIVE_CTX_SWITCH_ASM
+/* irq_disable() touched the process signal mask during a fast switch */
+static volatile int _native_fast_masked;
+#endif
+
 char __isr_stack[SIGSTKSZ];
 ucontext_t native_isr_context;
 ucontext_t *_native_cur_ctx, *_native_isr_ctx;
@@ -158,6 +163,9 @@ unsigned irq_disable(void)
 
     if (_native_in_isr == 1) {
         DEBUG("irq_disable + _native_in_isr\n");
+#if NATIVE_CTX_SWITCH_ASM
+        _native_fast_masked = 1;
+#endif
     }
 
     if (sigprocmask(SIG_SETMASK, &_native_sig_set_dint, NULL) == -1) {
@@ -223,6 +231,36 @@ void irq_restore(unsigned state)
     return;
 }
 
+#if NATIVE_CTX_SWITCH_ASM
+/**
+ * set the signal mask a context resumes with to "interrupts enabled"
+ */
+void _native_ctx_set_sigmask(ucontext_t *ctx)
+{
+    ctx->uc_sigmask = _native_sig_set;
+}
+
+/**
+ * run sched_run() for a fast switch as the ISR path does, with interrupts
+ * disabled. Only the flag is cleared, signals are queued by _native_in_isr
+ * anyway, so the process mask is restored only if a callee blocked them.
+ */
+void _native_fast_sched_run(void)
+{
+    _native_fast_masked = 0;
+    native_interrupts_enabled = 0;
+
+    sched_run();
+
+    native_interrupts_enabled = 1;
+    if (_native_fast_masked) {
+        if (sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
+            err(EXIT_FAILURE, "_native_fast_sched_run: sigprocmask");
+        }
+    }
+}
+#endif
+
 int irq_is_in(void)
 {
     DEBUG("irq_is_in: %i\n", _native_in_isr);
@@ -1,5 +1,6 @@
 /*
  * Copyright (C) 2016  OTA keys S.A.
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
  *
  * This file is subject to the terms and conditions of the GNU Lesser
  * General Public License v2.1. See the file LICENSE in the top level
@@ -19,6 +20,13 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <errno.h>
+#include <string.h>
+
+#ifdef MODULE_MTD_NATIVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include "mtd.h"
 #include "mtd_native.h"
@@ -28,12 +36,100 @@
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+static inline size_t _mtd_size(const mtd_dev_t *dev)
+{
+    return dev->sector_count * dev->pages_per_sector * dev->page_size;
+}
+
+static int _init_stats(mtd_native_dev_t *dev)
+{
+    if (dev->stats.sector_erases == NULL) {
+        dev->stats.sector_erases = real_calloc(dev->dev.sector_count,
+                                               sizeof(uint32_t));
+        if (dev->stats.sector_erases == NULL) {
+            return -ENOMEM;
+        }
+    }
+    return 0;
+}
+
+void mtd_native_stats_reset(mtd_native_dev_t *dev)
+{
+    uint32_t *sector_erases = dev->stats.sector_erases;
+
+    memset(&dev->stats, 0, sizeof(dev->stats));
+    if (sector_erases) {
+        memset(sector_erases, 0, dev->dev.sector_count * sizeof(uint32_t));
+        dev->stats.sector_erases = sector_erases;
+    }
+}
+
+#ifdef MODULE_MTD_NATIVE_MMAP
+/* maps fname with at least size bytes, old_size is set to its prior size */
+static uint8_t *_map_file(const char *fname, size_t size, size_t *old_size)
+{
+    int fd = real_open(fname, O_RDWR | O_CREAT, 0644);
+    if (fd == -1) {
+        return MAP_FAILED;
+    }
+
+    off_t end = real_lseek(fd, 0, SEEK_END);
+    if ((end == -1) ||
+        (((size_t)end < size) && (real_ftruncate(fd, size) == -1))) {
+        real_close(fd);
+        return MAP_FAILED;
+    }
+    *old_size = end;
+
+    uint8_t *mem = real_mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                             fd, 0);
+    /* the mapping keeps the file referenced */
+    real_close(fd);
+    return mem;
+}
+
+static int _init(mtd_dev_t *dev)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t size = _mtd_size(dev);
+    size_t old_size;
+
+    DEBUG("mtd_native: init, filename=%s (mmap)\n", _dev->fname);
+
+    if (_init_stats(_dev) < 0) {
+        return -ENOMEM;
+    }
+    if (_dev->mem) {
+        return 0;
+    }
+
+    _native_syscall_enter();
+    uint8_t *mem = _map_file(_dev->fname, size, &old_size);
+    _native_syscall_leave();
+    if (mem == MAP_FAILED) {
+        return -EIO;
+    }
+
+    if (old_size < size) {
+        DEBUG("mtd_native: init: erasing %u new bytes\n",
+              (unsigned)(size - old_size));
+        memset(mem + old_size, 0xff, size - old_size);
+    }
+    _dev->mem = mem;
+
+    return 0;
+}
+#else
 static int _init(mtd_dev_t *dev)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
 
     DEBUG("mtd_native: init, filename=%s\n", _dev->fname);
 
+    if (_init_stats(_dev) < 0) {
+        return -ENOMEM;
+    }
+
     FILE *f = real_fopen(_dev->fname, "r");
 
     if (!f) {
@@ -42,7 +138,7 @@ static int _init(mtd_dev_t *dev)
         if (!f) {
             return -EIO;
         }
-        size_t size = dev->sector_count * dev->pages_per_sector * dev->page_size;
+        size_t size = _mtd_size(dev);
         for (size_t i = 0; i < size; i++) {
             real_fputc(0xff, f);
         }
@@ -52,11 +148,12 @@ static int _init(mtd_dev_t *dev)
 
     return 0;
 }
+#endif
 
 static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
+    size_t mtd_size = _mtd_size(dev);
 
     DEBUG("mtd_native: read from page %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
@@ -64,6 +161,9 @@ static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
         return -EOVERFLOW;
     }
 
+#ifdef MODULE_MTD_NATIVE_MMAP
+    memcpy(buff, _dev->mem + addr, size);
+#else
     FILE *f = real_fopen(_dev->fname, "r");
     if (!f) {
         return -EIO;
@@ -71,6 +171,10 @@ static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
     real_fseek(f, addr, SEEK_SET);
     size = real_fread(buff, 1, size, f);
     real_fclose(f);
+#endif
+
+    _dev->stats.reads++;
+    _dev->stats.read_bytes += size;
 
     return size;
 }
@@ -78,7 +182,7 @@ static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
 static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
+    size_t mtd_size = _mtd_size(dev);
 
     DEBUG("mtd_native: write from 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
 
@@ -89,6 +193,13 @@ static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size
         return -EOVERFLOW;
     }
 
+#ifdef MODULE_MTD_NATIVE_MMAP
+    /* programming can only clear bits */
+    uint8_t *dst = _dev->mem + addr;
+    for (size_t i = 0; i < size; i++) {
+        dst[i] &= ((const uint8_t *)buff)[i];
+    }
+#else
     FILE *f = real_fopen(_dev->fname, "r+");
     if (!f) {
         return -EIO;
@@ -100,6 +211,10 @@ static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size
         real_fputc(c & ((uint8_t*)buff)[i], f);
     }
     real_fclose(f);
+#endif
+
+    _dev->stats.writes++;
+    _dev->stats.write_bytes += size;
 
     return size;
 }
@@ -107,7 +222,7 @@ static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size
 static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
+    size_t mtd_size = _mtd_size(dev);
     size_t sector_size = dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: erase from sector %" PRIu32 " count %" PRIu32 "\n", addr, size);
@@ -119,6 +234,9 @@ static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
         return -EOVERFLOW;
     }
 
+#ifdef MODULE_MTD_NATIVE_MMAP
+    memset(_dev->mem + addr, 0xff, size);
+#else
     FILE *f = real_fopen(_dev->fname, "r+");
     if (!f) {
         return -EIO;
@@ -128,16 +246,40 @@ static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
         real_fputc(0xff, f);
     }
     real_fclose(f);
+#endif
+
+    _dev->stats.erases++;
+    _dev->stats.erase_bytes += size;
+    if (_dev->stats.sector_erases) {
+        for (uint32_t sector = addr / sector_size;
+             sector < (addr + size) / sector_size; sector++) {
+            _dev->stats.sector_erases[sector]++;
+        }
+    }
 
     return 0;
 }
 
 static int _power(mtd_dev_t *dev, enum mtd_power_state power)
 {
+#ifdef MODULE_MTD_NATIVE_MMAP
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+
+    if ((power == MTD_POWER_DOWN) && MTD_NATIVE_MMAP_SYNC && _dev->mem) {
+        _native_syscall_enter();
+        int res = real_msync(_dev->mem, _mtd_size(dev), MS_SYNC);
+        _native_syscall_leave();
+        if (res == -1) {
+            return -EIO;
+        }
+    }
+    return 0;
+#else
     (void) dev;
     (void) power;
 
     return -ENOTSUP;
+#endif
 }
 
 
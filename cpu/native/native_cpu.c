@@ -17,6 +17,8 @@
  *
  * in-process preemptive context switching utilizes POSIX ucontexts.
  * (ucontext provides for architecture independent stack handling)
+ * On x86-64 Linux, voluntary yields use the register-only switch in tramp.S
+ * (see NATIVE_CTX_SWITCH_ASM).
  *
  * @author  Ludwig Knüpfer <ludwig.knuepfer@fu-berlin.de>
  * @author  Kaspar Schleiser <kaspar@schleiser.de>
@@ -214,10 +216,89 @@ void isr_thread_yield(void)
     }
 }
 
+#if NATIVE_CTX_SWITCH_ASM
+_Static_assert((REG_RSP == 15) && (REG_RIP == 16),
+               "tramp.S relies on the glibc x86-64 gregs layout");
+
+void _native_ctx_resume_full(ucontext_t *ctx)
+{
+    if (_native_sigpend > 0) {
+        /* signals were queued while switching, otherwise they wait for the
+         * next signal: handle them on the ISR stack like thread_yield_higher()
+         * does. isr_thread_yield() resumes the scheduled thread itself. */
+        irq_disable();
+        native_isr_context.uc_stack.ss_sp = __isr_stack;
+        native_isr_context.uc_stack.ss_size = sizeof(__isr_stack);
+        native_isr_context.uc_stack.ss_flags = 0;
+        makecontext(&native_isr_context, isr_thread_yield, 0);
+        if (setcontext(&native_isr_context) == -1) {
+            err(EXIT_FAILURE, "_native_ctx_resume_full: setcontext");
+        }
+    }
+
+    native_interrupts_enabled = 1;
+    _native_mod_ctx_leave_sigh(ctx);
+
+    if (setcontext(ctx) == -1) {
+        err(EXIT_FAILURE, "_native_ctx_resume_full: setcontext");
+    }
+    errx(EXIT_FAILURE, "4 this should have never been reached!!");
+}
+
+/**
+ * Voluntary context switch without leaving the thread's stack.
+ *
+ * Setting _native_in_isr makes the signal handler only queue incoming
+ * signals, so no signal needs to be masked while the scheduler runs and the
+ * stacks are exchanged. Queued signals are handled once the yielding thread
+ * is resumed.
+ */
+static int _native_yield_fast(void)
+{
+    thread_t *prev = (thread_t *)sched_active_thread;
+
+    if (!native_interrupts_enabled || (_native_sigpend > 0)) {
+        return 0;
+    }
+
+    _native_in_isr = 1;
+    _native_fast_sched_run();
+
+    thread_t *next = (thread_t *)sched_active_thread;
+    if (next != prev) {
+        ucontext_t *from = (ucontext_t *)prev->sp;
+        ucontext_t *to = (ucontext_t *)next->sp;
+
+        _native_ctx_set_sigmask(from);
+        if (to->uc_mcontext.gregs[REG_RIP] == (greg_t)&_native_ctx_resume) {
+            _native_ctx_switch(from->uc_mcontext.gregs, to->uc_mcontext.gregs, NULL);
+        }
+        else {
+            /* preempted or new thread, resume the full context */
+            _native_ctx_switch(from->uc_mcontext.gregs, NULL, to);
+        }
+    }
+
+    _native_in_isr = 0;
+    if (_native_sigpend > 0) {
+        /* handle signals queued while switching */
+        _native_syscall_enter();
+        _native_syscall_leave();
+    }
+    return 1;
+}
+#endif
+
 void thread_yield_higher(void)
 {
     sched_context_switch_request = 1;
 
+#if NATIVE_CTX_SWITCH_ASM
+    if ((_native_in_isr == 0) && _native_yield_fast()) {
+        return;
+    }
+#endif
+
     if (_native_in_isr == 0) {
         ucontext_t *ctx = (ucontext_t *)(sched_active_thread->sp);
         _native_in_isr = 1;
@@ -226,7 +307,7 @@ void thread_yield_higher(void)
         }
         irq_disable();
         native_isr_context.uc_stack.ss_sp = __isr_stack;
-        native_isr_context.uc_stack.ss_size = SIGSTKSZ;
+        native_isr_context.uc_stack.ss_size = sizeof(__isr_stack);
         native_isr_context.uc_stack.ss_flags = 0;
         makecontext(&native_isr_context, isr_thread_yield, 0);
         if (swapcontext(ctx, &native_isr_context) == -1) {
@@ -243,7 +324,7 @@ void native_cpu_init(void)
     }
 
     end_context.uc_stack.ss_sp = __end_stack;
-    end_context.uc_stack.ss_size = SIGSTKSZ;
+    end_context.uc_stack.ss_size = sizeof(__end_stack);
     end_context.uc_stack.ss_flags = 0;
     makecontext(&end_context, sched_task_exit, 0);
     (void) VALGRIND_STACK_REGISTER(__end_stack, __end_stack + sizeof(__end_stack));
@@ -70,6 +70,7 @@
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
+static int _read_frame(netdev_tap_t *dev);
 
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
 {
@@ -96,18 +97,60 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
     return value;
 }
 
-static inline void _isr(netdev_t *netdev)
+static void _continue_reading(netdev_tap_t *dev)
 {
-    if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+#if defined(__linux__) || defined(__MACH__)
+    /* pending frames are reported again once the TAP is re-armed */
+    native_async_read_continue(dev->tap_fd);
+#else
+    /* with O_ASYNC, SIGIO is only raised for new data, so frames left over
+     * after the budget would wait for the next one */
+    fd_set rfds;
+    struct timeval t;
+    memset(&t, 0, sizeof(t));
+    FD_ZERO(&rfds);
+    FD_SET(dev->tap_fd, &rfds);
+
+    _native_in_syscall++; /* no switching here */
+
+    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+        int sig = SIGIO;
+        real_write(_sig_pipefd[1], &sig, sizeof(int));
+        _native_sigpend++;
+        DEBUG("netdev_tap: sigpend++\n");
     }
-#if DEVELHELP
     else {
-        puts("netdev_tap: _isr(): no event_callback set.");
+        DEBUG("netdev_tap: native_async_read_continue\n");
+        native_async_read_continue(dev->tap_fd);
     }
+
+    _native_in_syscall--;
 #endif
 }
 
+static void _isr(netdev_t *netdev)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+
+    if (!netdev->event_callback) {
+#if DEVELHELP
+        puts("netdev_tap: _isr(): no event_callback set.");
+#endif
+        native_async_read_continue(dev->tap_fd);
+        return;
+    }
+
+    /* hand all pending frames to the stack, the TAP is only monitored again
+     * afterwards, so there is one interrupt per batch instead of per frame */
+    for (unsigned i = 0; (i < NETDEV_TAP_RX_BUDGET) && _read_frame(dev); i++) {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        /* frame was not fetched by the upper layer */
+        dev->rx_len = 0;
+    }
+
+    _continue_reading(dev);
+}
+
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
 {
     int res = 0;
@@ -179,31 +222,41 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
-static void _continue_reading(netdev_tap_t *dev)
+/* reads the next frame addressed to us into rx_buf, returns 0 if drained */
+static int _read_frame(netdev_tap_t *dev)
 {
-    /* work around lost signals */
-    fd_set rfds;
-    struct timeval t;
-    memset(&t, 0, sizeof(t));
-    FD_ZERO(&rfds);
-    FD_SET(dev->tap_fd, &rfds);
-
-    _native_in_syscall++; /* no switching here */
-
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
-        int sig = SIGIO;
-        extern int _sig_pipefd[2];
-        extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
-        real_write(_sig_pipefd[1], &sig, sizeof(int));
-        _native_sigpend++;
-        DEBUG("netdev_tap: sigpend++\n");
-    }
-    else {
-        DEBUG("netdev_tap: native_async_read_continue\n");
-        native_async_read_continue(dev->tap_fd);
+    while (1) {
+        int nread = real_read(dev->tap_fd, dev->rx_buf, sizeof(dev->rx_buf));
+        DEBUG("netdev_tap: read %d bytes\n", nread);
+
+        if (nread > 0) {
+            ethernet_hdr_t *hdr = (ethernet_hdr_t *)dev->rx_buf;
+            if (((size_t)nread < sizeof(ethernet_hdr_t)) ||
+                (!(dev->promiscous) && !_is_addr_multicast(hdr->dst) &&
+                 !_is_addr_broadcast(hdr->dst) &&
+                 (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0))) {
+                DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+                      "That's not me => Dropped\n",
+                      hdr->dst[0], hdr->dst[1], hdr->dst[2],
+                      hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+                continue;
+            }
+            dev->rx_len = nread;
+            return 1;
+        }
+        else if (nread == -1) {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                err(EXIT_FAILURE, "netdev_tap: read");
+            }
+        }
+        else if (nread == 0) {
+            DEBUG("_native_handle_tap_input: ignoring null-event\n");
+        }
+        else {
+            errx(EXIT_FAILURE, "internal error _rx_event");
+        }
+        return 0;
     }
-
-    _native_in_syscall--;
 }
 
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
@@ -211,68 +264,31 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     netdev_tap_t *dev = (netdev_tap_t*)netdev;
     (void)info;
 
+    if (dev->rx_len == 0) {
+        return -1;
+    }
+
     if (!buf) {
         if (len > 0) {
             /* no memory available in pktbuf, discarding the frame */
             DEBUG("netdev_tap: discarding the frame\n");
-
-            /* repeating `real_read` for small size on tap device results in
-             * freeze for some reason. Using a large buffer for now. */
-            /*
-            uint8_t buf[4];
-            while (real_read(dev->tap_fd, buf, sizeof(buf)) > 0) {
-            }
-            */
-
-            static uint8_t nullbuf[ETHERNET_FRAME_LEN];
-
-            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
-
-            _continue_reading(dev);
-        }
-
-        /* no way of figuring out packet size without racey buffering,
-         * so we return the maximum possible size */
-        return ETHERNET_FRAME_LEN;
-    }
-
-    int nread = real_read(dev->tap_fd, buf, len);
-    DEBUG("netdev_tap: read %d bytes\n", nread);
-
-    if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
-
-            native_async_read_continue(dev->tap_fd);
-
+            dev->rx_len = 0;
             return 0;
         }
-
-        _continue_reading(dev);
-
-        return nread;
-    }
-    else if (nread == -1) {
-        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-        }
-        else {
-            err(EXIT_FAILURE, "netdev_tap: read");
-        }
+        return dev->rx_len;
     }
-    else if (nread == 0) {
-        DEBUG("_native_handle_tap_input: ignoring null-event\n");
+
+    int nread = dev->rx_len;
+    if ((size_t)nread > len) {
+        DEBUG("netdev_tap: frame does not fit into buffer\n");
+        nread = -ENOBUFS;
     }
     else {
-        errx(EXIT_FAILURE, "internal error _rx_event");
+        memcpy(buf, dev->rx_buf, nread);
     }
+    dev->rx_len = 0;
 
-    return -1;
+    return nread;
 }
 
 static int _send(netdev_t *netdev, const iolist_t *iolist)
@@ -299,8 +315,6 @@ void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params) {
 }
 
 static void _tap_isr(int fd, void *arg) {
-    (void) fd;
-
     netdev_t *netdev = (netdev_t *)arg;
 
     if (netdev->event_callback) {
@@ -308,6 +322,7 @@ static void _tap_isr(int fd, void *arg) {
     }
     else {
         puts("netdev_tap: _isr: no event callback.");
+        native_async_read_continue(fd);
     }
 }
 
@@ -335,6 +350,7 @@ static int _init(netdev_t *netdev)
 #endif
     /* initialize device descriptor */
     dev->promiscous = 0;
+    dev->rx_len = 0;
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
@@ -18,6 +18,7 @@
  */
 
 #include <err.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -31,8 +32,28 @@
 
 void pm_set_lowest(void)
 {
+    sigset_t block, old;
+
     _native_in_syscall++; /* no switching here */
-    real_pause();
+
+    /* A signal arriving between the check for pending interrupts and pause()
+     * would only be pended and the process would sleep until the next one.
+     * Block all signals while checking, sigsuspend() atomically unblocks
+     * them again. */
+    sigfillset(&block);
+    sigprocmask(SIG_SETMASK, &block, &old);
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    /* nothing can run before the next timer expiry, so jump the clock there
+     * instead of sleeping. Only wait for the host if no timer is armed. */
+    if (_native_sigpend == 0) {
+        _native_timer_skip();
+    }
+#endif
+    if (_native_sigpend == 0) {
+        sigsuspend(&old);
+    }
+    sigprocmask(SIG_SETMASK, &old, NULL);
+
     _native_in_syscall--;
 
     if (_native_sigpend > 0) {
@@ -62,6 +62,19 @@ static void *_cb_arg;
 
 static struct itimerval itv;
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+/**
+ * ticks the clock skipped while the whole system was idle
+ */
+static timer_val_t _skipped;
+/**
+ * absolute deadline and relative offset of the armed channel,
+ * _armed_offset == 0 means disarmed
+ */
+static timer_val_t _deadline;
+static timer_val_t _armed_offset;
+#endif
+
 /**
  * returns ticks for give timespec
  */
@@ -80,6 +93,10 @@ void native_isr_timer(void)
 {
     DEBUG("%s\n", __func__);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _armed_offset = 0;
+#endif
+
     _callback(_cb_arg, 0);
 }
 
@@ -126,7 +143,52 @@ static void do_timer_set(timer_val_t offset)
         err(EXIT_FAILURE, "timer_arm: setitimer");
     }
     _native_syscall_leave();
+
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _armed_offset = offset;
+    _deadline = timer_read(0) + offset;
+#endif
+}
+
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+int _native_timer_skip(void)
+{
+    if (!_armed_offset) {
+        return 0;
+    }
+
+    /* the caller blocks all signals: if the host timer expired already, its
+     * SIGALRM is pending and handled once they are unblocked again, pending
+     * another expiry would run the callback twice */
+    sigset_t pending;
+    if ((sigpending(&pending) == 0) && sigismember(&pending, SIGALRM)) {
+        return 0;
+    }
+
+    timer_val_t now = timer_read(0);
+    timer_val_t left = _deadline - now;
+
+    /* a deadline that already passed shows up as a huge wrapped distance */
+    if (left <= _armed_offset) {
+        _skipped += left;
+    }
+    _armed_offset = 0;
+
+    /* disarm the host timer and pend the expiry as if SIGALRM had arrived */
+    memset(&itv, 0, sizeof(itv));
+    if (real_setitimer(ITIMER_REAL, &itv, NULL) == -1) {
+        err(EXIT_FAILURE, "_native_timer_skip: setitimer");
+    }
+
+    int sig = SIGALRM;
+    if (real_write(_sig_pipefd[1], &sig, sizeof(int)) == -1) {
+        err(EXIT_FAILURE, "_native_timer_skip: real_write()");
+    }
+    _native_sigpend++;
+
+    return 1;
 }
+#endif
 
 int timer_set(tim_t dev, int channel, timer_val_t offset)
 {
@@ -148,7 +210,14 @@ int timer_set(tim_t dev, int channel, timer_val_t offset)
 
 int timer_set_absolute(tim_t dev, int channel, timer_val_t value)
 {
-	timer_val_t now = timer_read(dev);
+    timer_val_t now = timer_read(dev);
+#ifdef TIMER_64BIT_HW
+    /* the 64 bit counter never wraps, so a target that passed while getting
+     * here must fire right away instead of after 2^64 ticks */
+    if (value <= now) {
+        return timer_set(dev, channel, 0);
+    }
+#endif
     return timer_set(dev, channel, value - now);
 }
 
@@ -202,5 +271,9 @@ timer_val_t timer_read(tim_t dev)
 #endif
     _native_syscall_leave();
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    return ts2ticks(&t) - time_null + _skipped;
+#else
     return ts2ticks(&t) - time_null;
+#endif
 }
@@ -131,6 +131,10 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
 
 static void _continue_reading(socket_zep_t *dev)
 {
+#ifdef __linux__
+    /* re-arming reports data that is still pending, no signal gets lost */
+    native_async_read_continue(dev->sock_fd);
+#else
     /* work around lost signals */
     fd_set rfds;
     struct timeval t;
@@ -152,6 +156,7 @@ static void _continue_reading(socket_zep_t *dev)
     }
 
     _native_in_syscall--;
+#endif
 }
 
 static inline bool _dst_not_me(socket_zep_t *dev, const void *buf)
@@ -173,6 +178,72 @@ static inline bool _dst_not_me(socket_zep_t *dev, const void *buf)
     }
 }
 
+/* reads one frame, returns its payload length or -1 if it was dropped */
+static int _read_frame(socket_zep_t *dev, void *buf, size_t len, void *info)
+{
+    int size = real_read(dev->sock_fd, dev->rcv_buf, sizeof(dev->rcv_buf));
+
+    if (size > 0) {
+        zep_hdr_t *tmp = (zep_hdr_t *)&dev->rcv_buf;
+
+        if ((tmp->preamble[0] != 'E') || (tmp->preamble[1] != 'X')) {
+            DEBUG("socket_zep::recv: invalid ZEP header");
+            return -1;
+        }
+        switch (tmp->version) {
+            case 2: {
+                zep_v2_data_hdr_t *zep = (zep_v2_data_hdr_t *)tmp;
+                void *payload = &dev->rcv_buf[sizeof(zep_v2_data_hdr_t)];
+
+                if (zep->type != ZEP_V2_TYPE_DATA) {
+                    DEBUG("socket_zep::recv: unexpect ZEP type\n");
+                    /* don't support ACK frames for now*/
+                    return -1;
+                }
+                if (((sizeof(zep_v2_data_hdr_t) + zep->length) != (unsigned)size) ||
+                    (zep->length > len) || (zep->chan != dev->netdev.chan) ||
+                    /* TODO promiscous mode */
+                    _dst_not_me(dev, payload)) {
+                    /* TODO: check checksum */
+                    return -1;
+                }
+                /* don't hand FCS to stack */
+                size = zep->length - sizeof(uint16_t);
+                if (buf != NULL) {
+                    memcpy(buf, payload, size);
+                    if (info != NULL) {
+                        struct netdev_radio_rx_info *rx_info = info;
+                        rx_info->lqi = zep->lqi_val;
+                        rx_info->rssi = UINT8_MAX;
+                    }
+                }
+                break;
+            }
+            default:
+                DEBUG("socket_zep::recv: unexpected ZEP version\n");
+                return -1;
+        }
+    }
+    else if (size == 0) {
+        DEBUG("socket_zep::recv: ignoring null-event\n");
+        return -1;
+    }
+    else if (size == -1) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK) ||
+            /* ICMP error of an earlier send to a remote that was not up */
+            (errno == ECONNREFUSED)) {
+        }
+        else {
+            err(EXIT_FAILURE, "zep: read");
+        }
+    }
+    else {
+        errx(EXIT_FAILURE, "internal error _rx_event");
+    }
+
+    return size;
+}
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     socket_zep_t *dev = (socket_zep_t *)netdev;
@@ -190,66 +261,21 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 #else
         (void)res;
 #endif
+        if (size == 0) {
+            /* the socket was readable due to a pending error (e.g. an ICMP
+             * port unreachable of an earlier send): clear it and re-arm, as
+             * the caller will not read */
+            int sock_err;
+            socklen_t sock_err_len = sizeof(sock_err);
+
+            getsockopt(dev->sock_fd, SOL_SOCKET, SO_ERROR, &sock_err,
+                       &sock_err_len);
+            _continue_reading(dev);
+        }
         return size;
     }
     else if (len > 0) {
-        size = real_read(dev->sock_fd, dev->rcv_buf, sizeof(dev->rcv_buf));
-
-        if (size > 0) {
-            zep_hdr_t *tmp = (zep_hdr_t *)&dev->rcv_buf;
-
-            if ((tmp->preamble[0] != 'E') || (tmp->preamble[1] != 'X')) {
-                DEBUG("socket_zep::recv: invalid ZEP header");
-                return -1;
-            }
-            switch (tmp->version) {
-                case 2: {
-                    zep_v2_data_hdr_t *zep = (zep_v2_data_hdr_t *)tmp;
-                    void *payload = &dev->rcv_buf[sizeof(zep_v2_data_hdr_t)];
-
-                    if (zep->type != ZEP_V2_TYPE_DATA) {
-                        DEBUG("socket_zep::recv: unexpect ZEP type\n");
-                        /* don't support ACK frames for now*/
-                        return -1;
-                    }
-                    if (((sizeof(zep_v2_data_hdr_t) + zep->length) != (unsigned)size) ||
-                        (zep->length > len) || (zep->chan != dev->netdev.chan) ||
-                        /* TODO promiscous mode */
-                        _dst_not_me(dev, payload)) {
-                        /* TODO: check checksum */
-                        return -1;
-                    }
-                    /* don't hand FCS to stack */
-                    size = zep->length - sizeof(uint16_t);
-                    if (buf != NULL) {
-                        memcpy(buf, payload, size);
-                        if (info != NULL) {
-                            struct netdev_radio_rx_info *rx_info = info;
-                            rx_info->lqi = zep->lqi_val;
-                            rx_info->rssi = UINT8_MAX;
-                        }
-                    }
-                    break;
-                }
-                default:
-                    DEBUG("socket_zep::recv: unexpected ZEP version\n");
-                    return -1;
-            }
-        }
-        else if (size == 0) {
-            DEBUG("socket_zep::recv: ignoring null-event\n");
-            return -1;
-        }
-        else if (size == -1) {
-            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-            }
-            else {
-                err(EXIT_FAILURE, "zep: read");
-            }
-        }
-        else {
-            errx(EXIT_FAILURE, "internal error _rx_event");
-        }
+        size = _read_frame(dev, buf, len, info);
     }
     _continue_reading(dev);
 
@@ -261,6 +287,15 @@ static void _isr(netdev_t *netdev)
     if (netdev->event_callback) {
         socket_zep_t *dev = (socket_zep_t *)netdev;
 
+        if (dev->rx_pending) {
+            /* a simulated TX interrupt may have overwritten last_event since
+             * the socket became readable */
+            dev->rx_pending = false;
+            DEBUG("socket_zep::isr: firing %u\n",
+                  (unsigned)NETDEV_EVENT_RX_COMPLETE);
+            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+            return;
+        }
         DEBUG("socket_zep::isr: firing %u\n", (unsigned)dev->last_event);
         netdev->event_callback(netdev, dev->last_event);
     }
@@ -281,7 +316,7 @@ static void _socket_isr(int fd, void *arg)
     if (netdev->event_callback) {
         socket_zep_t *dev = (socket_zep_t *)netdev;
 
-        dev->last_event = NETDEV_EVENT_RX_COMPLETE;
+        dev->rx_pending = true;
         netdev->event_callback(netdev, NETDEV_EVENT_ISR);
     }
 }
@@ -72,6 +72,7 @@ int (*real_getpid)(void);
 int (*real_chdir)(const char *path);
 int (*real_close)(int);
 int (*real_fcntl)(int, int, ...);
+int (*real_ftruncate)(int fd, off_t length);
 int (*real_creat)(const char *path, ...);
 int (*real_dup2)(int, int);
 int (*real_execve)(const char *, char *const[], char *const[]);
@@ -79,6 +80,10 @@ int (*real_fork)(void);
 int (*real_feof)(FILE *stream);
 int (*real_ferror)(FILE *stream);
 int (*real_listen)(int socket, int backlog);
+off_t (*real_lseek)(int fd, off_t offset, int whence);
+void* (*real_mmap)(void *addr, size_t length, int prot, int flags, int fd,
+                   off_t offset);
+int (*real_msync)(void *addr, size_t length, int flags);
 int (*real_ioctl)(int fildes, int request, ...);
 int (*real_open)(const char *path, int oflag, ...);
 int (*real_pause)(void);
@@ -104,6 +109,16 @@ ssize_t (*real_writev)(int fildes, const struct iovec *iov, int iovcnt);
 #else
 int (*real_clock_gettime)(clockid_t clk_id, struct timespec *tp);
 #endif
+#ifdef __linux__
+int (*real_epoll_create1)(int flags);
+int (*real_epoll_ctl)(int epfd, int op, int fd, struct epoll_event *event);
+int (*real_epoll_wait)(int epfd, struct epoll_event *events, int maxevents,
+                       int timeout);
+int (*real_pthread_create)(unsigned long *thread, const void *attr,
+                           void *(*start_routine)(void *), void *arg);
+int (*real_pthread_kill)(unsigned long thread, int sig);
+unsigned long (*real_pthread_self)(void);
+#endif
 
 void _native_syscall_enter(void)
 {
@@ -130,7 +145,7 @@ void _native_syscall_leave(void)
         _native_in_isr = 1;
         _native_cur_ctx = (ucontext_t *)sched_active_thread->sp;
         native_isr_context.uc_stack.ss_sp = __isr_stack;
-        native_isr_context.uc_stack.ss_size = SIGSTKSZ;
+        native_isr_context.uc_stack.ss_size = sizeof(__isr_stack);
         native_isr_context.uc_stack.ss_flags = 0;
         native_interrupts_enabled = 0;
         makecontext(&native_isr_context, native_irq_handler, 0);
@@ -470,6 +485,7 @@ void _native_init_syscalls(void)
     *(void **)(&real_chdir) = dlsym(RTLD_NEXT, "chdir");
     *(void **)(&real_close) = dlsym(RTLD_NEXT, "close");
     *(void **)(&real_fcntl) = dlsym(RTLD_NEXT, "fcntl");
+    *(void **)(&real_ftruncate) = dlsym(RTLD_NEXT, "ftruncate");
     *(void **)(&real_creat) = dlsym(RTLD_NEXT, "creat");
     *(void **)(&real_fork) = dlsym(RTLD_NEXT, "fork");
     *(void **)(&real_dup2) = dlsym(RTLD_NEXT, "dup2");
@@ -483,6 +499,9 @@ void _native_init_syscalls(void)
     *(void **)(&real_execve) = dlsym(RTLD_NEXT, "execve");
     *(void **)(&real_ioctl) = dlsym(RTLD_NEXT, "ioctl");
     *(void **)(&real_listen) = dlsym(RTLD_NEXT, "listen");
+    *(void **)(&real_lseek) = dlsym(RTLD_NEXT, "lseek");
+    *(void **)(&real_mmap) = dlsym(RTLD_NEXT, "mmap");
+    *(void **)(&real_msync) = dlsym(RTLD_NEXT, "msync");
     *(void **)(&real_open) = dlsym(RTLD_NEXT, "open");
     *(void **)(&real_pause) = dlsym(RTLD_NEXT, "pause");
     *(void **)(&real_fopen) = dlsym(RTLD_NEXT, "fopen");
@@ -500,4 +519,12 @@ void _native_init_syscalls(void)
 #else
     *(void **)(&real_clock_gettime) = dlsym(RTLD_NEXT, "clock_gettime");
 #endif
+#ifdef __linux__
+    *(void **)(&real_epoll_create1) = dlsym(RTLD_NEXT, "epoll_create1");
+    *(void **)(&real_epoll_ctl) = dlsym(RTLD_NEXT, "epoll_ctl");
+    *(void **)(&real_epoll_wait) = dlsym(RTLD_NEXT, "epoll_wait");
+    *(void **)(&real_pthread_create) = dlsym(RTLD_NEXT, "pthread_create");
+    *(void **)(&real_pthread_kill) = dlsym(RTLD_NEXT, "pthread_kill");
+    *(void **)(&real_pthread_self) = dlsym(RTLD_NEXT, "pthread_self");
+#endif
 }
@@ -106,6 +106,9 @@ then
     then
         make -C ./tests/unittests all-debug test BOARD=native TERMPROG='gdb -batch -ex r -ex bt $(ELF)' || exit
         set_result $?
+        # suites that need their own build of the module under test
+        make -C ./tests/unittests clean tests-fib_linear tests-fib_sr_linear tests-gnrc_ipv6_nib_linear all-debug test BOARD=native TERMPROG='gdb -batch -ex r -ex bt $(ELF)' || exit
+        set_result $?
     fi
 
 
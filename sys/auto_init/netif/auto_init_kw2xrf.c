@@ -34,7 +34,7 @@
  * @brief   Define stack parameters for the MAC layer thread
  * @{
  */
-#define KW2XRF_MAC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#define KW2XRF_MAC_STACKSIZE     (GNRC_NETIF_STACKSIZE)
 #ifndef KW2XRF_MAC_PRIO
 #define KW2XRF_MAC_PRIO          (GNRC_NETIF_PRIO)
 #endif
@@ -31,7 +31,7 @@
  * @brief   Define stack parameters for the MAC layer thread
  * @{
  */
-#define MRF24J40_MAC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#define MRF24J40_MAC_STACKSIZE     (GNRC_NETIF_STACKSIZE)
 #ifndef MRF24J40_MAC_PRIO
 #define MRF24J40_MAC_PRIO          (GNRC_NETIF_PRIO)
 #endif
@@ -30,7 +30,7 @@
  * @{
  */
 #ifndef NRF802154_MAC_STACKSIZE
-#define NRF802154_MAC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#define NRF802154_MAC_STACKSIZE     (GNRC_NETIF_STACKSIZE)
 #endif
 #ifndef NRF802154_MAC_PRIO
 #define NRF802154_MAC_PRIO          (GNRC_NETIF_PRIO)
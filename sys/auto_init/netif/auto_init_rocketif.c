@@ -24,7 +24,7 @@
  * @brief   Define stack parameters for the MAC layer thread
  * @{
  */
-#define ROCKETIF_MAC_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#define ROCKETIF_MAC_STACKSIZE     (GNRC_NETIF_STACKSIZE)
 #define ROCKETIF_MAC_PRIO          (GNRC_NETIF_PRIO)
 
 
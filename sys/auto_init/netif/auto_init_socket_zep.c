@@ -30,7 +30,7 @@
 /**
  * @brief   Define stack parameters for the MAC layer thread
  */
-#define SOCKET_ZEP_MAC_STACKSIZE    (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE)
+#define SOCKET_ZEP_MAC_STACKSIZE    (GNRC_NETIF_STACKSIZE + DEBUG_EXTRA_STACKSIZE)
 #ifndef SOCKET_ZEP_MAC_PRIO
 #define SOCKET_ZEP_MAC_PRIO         (GNRC_NETIF_PRIO)
 #endif
@@ -171,6 +171,23 @@ uint32_t rotating_hash(const uint8_t *buf, size_t len);
  */
 uint32_t one_at_a_time_hash(const uint8_t *buf, size_t len);
 
+/**
+ * @defgroup sys_hashes_fibonacci Fibonacci hashing
+ * @ingroup sys_hashes_non_crypto
+ * @brief Fibonacci hashing of a 32 bit key.
+ *
+ * Multiplies the key with 2^32 divided by the golden ratio. Consecutive keys
+ * end up far apart in the upper bits of the result, so take the index of a
+ * table from those. Does not need the `hashes` module.
+ *
+ * @param key key to hash
+ * @return 32 bit sized hash
+ */
+static inline uint32_t fibonacci_hash(uint32_t key)
+{
+    return key * 2654435769U;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -64,6 +64,23 @@ void isrpipe_init(isrpipe_t *isrpipe, char *buf, size_t bufsize);
  */
 int isrpipe_write_one(isrpipe_t *isrpipe, char c);
 
+/**
+ * @brief   Put a number of characters into the isrpipe's buffer
+ *
+ * The characters are copied in one go and a waiting reader is woken up once.
+ * Drivers that receive into their own buffers can instead write directly
+ * into the ring with spsc_ring_reserve() and spsc_ring_commit() on
+ * isrpipe_t::tsrb and call this function with @p count 0 to wake the reader.
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[in]   buf         characters to add to isrpipe buffer
+ * @param[in]   count       number of characters in @p buf
+ *
+ * @returns     number of characters added, less than @p count if the
+ *              buffer got full
+ */
+int isrpipe_write(isrpipe_t *isrpipe, const char *buf, size_t count);
+
 /**
  * @brief   Read data from isrpipe (blocking)
  *
@@ -484,6 +484,20 @@ void fib_print_fib_table(fib_table_t *table);
  */
 void fib_print_routes(fib_table_t *table);
 
+/**
+ * @brief Prints the lookup statistics of the FIB and the index in use
+ *
+ * @param[in] table         the fib instance to print the statistics of
+ */
+void fib_print_stats(fib_table_t *table);
+
+/**
+ * @brief Resets the lookup statistics of the FIB
+ *
+ * @param[in] table         the fib instance to reset the statistics of
+ */
+void fib_reset_stats(fib_table_t *table);
+
 /**
 * @brief Prints the given FIB sourceroute
 *
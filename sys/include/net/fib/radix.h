@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_fib_radix FIB radix index
+ * @ingroup     net_fib
+ * @brief       Path-compressed binary trie indexing the entries of a FIB table
+ *
+ * To activate, use `USEMODULE += fib_radix` in your applications Makefile
+ * and provide a node pool of @ref FIB_RADIX_NODES_NUMOF nodes in
+ * fib_table_t::radix before calling fib_init(). Tables without a node pool
+ * are searched linearly as before.
+ *
+ * Keys are bit strings of up to @ref FIB_RADIX_KEY_SIZE bytes. Every item is
+ * stored under its own key; items with equal keys are kept in the order of
+ * their addresses, i.e. in the order of the arrays they are taken from, so
+ * lookups find the same item a linear search over that array would find.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Radix index for FIB tables
+ */
+
+#ifndef NET_FIB_RADIX_H
+#define NET_FIB_RADIX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "universal_address.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum size of a key in bytes
+ *
+ * A key consists of one byte identifying the address size followed by the
+ * address.
+ */
+#define FIB_RADIX_KEY_SIZE          (1 + UNIVERSAL_ADDRESS_SIZE)
+
+/**
+ * @brief   Number of nodes required to index @p items items
+ *
+ * At most one branch node is required per distinct key.
+ */
+#define FIB_RADIX_NODES_NUMOF(items)    (2 * (items))
+
+/**
+ * @brief   Node of a radix index
+ */
+typedef struct fib_radix_node {
+    struct fib_radix_node *child[2];    /**< sub-tries by bit fib_radix_node_t::key_len */
+    struct fib_radix_node *dup;         /**< next node with an item of the same key */
+    void *item;                         /**< indexed item, NULL for branch nodes */
+    uint16_t key_len;                   /**< length of fib_radix_node_t::key in bits */
+    uint8_t key[FIB_RADIX_KEY_SIZE];    /**< key of the node */
+} fib_radix_node_t;
+
+/**
+ * @brief   Radix index
+ */
+typedef struct {
+    fib_radix_node_t *nodes;    /**< node pool, NULL to disable the index */
+    size_t nodes_numof;         /**< number of nodes in fib_radix_t::nodes */
+    size_t nodes_used;          /**< nodes currently in use */
+    size_t nodes_next;          /**< next node of the pool never used before */
+    fib_radix_node_t *root;     /**< root of the trie */
+    fib_radix_node_t *free;     /**< released nodes */
+    bool overflow;              /**< an item could not be indexed */
+} fib_radix_t;
+
+/**
+ * @brief   Empties a radix index
+ *
+ * fib_radix_t::nodes and fib_radix_t::nodes_numof are kept.
+ *
+ * @param[in,out] radix     the radix index
+ */
+void fib_radix_init(fib_radix_t *radix);
+
+/**
+ * @brief   Indicates whether a radix index can be used for lookups
+ *
+ * @param[in] radix     the radix index
+ *
+ * @return  true, if a node pool is provided and all items are indexed
+ * @return  false otherwise
+ */
+static inline bool fib_radix_usable(const fib_radix_t *radix)
+{
+    return (radix->nodes != NULL) && !radix->overflow;
+}
+
+/**
+ * @brief   Adds an item to a radix index
+ *
+ * If the node pool is exhausted, fib_radix_t::overflow is set and the index
+ * must no longer be used until fib_radix_init() is called.
+ *
+ * @param[in,out] radix     the radix index
+ * @param[in] key           the key of @p item
+ * @param[in] key_len       length of @p key in bits
+ * @param[in] item          the item, must not be NULL
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the node pool is exhausted
+ */
+int fib_radix_insert(fib_radix_t *radix, const uint8_t *key, unsigned key_len,
+                     void *item);
+
+/**
+ * @brief   Removes an item from a radix index
+ *
+ * Nothing happens if @p item is not stored under @p key.
+ *
+ * @param[in,out] radix     the radix index
+ * @param[in] key           the key @p item was added with
+ * @param[in] key_len       length of @p key in bits
+ * @param[in] item          the item
+ */
+void fib_radix_remove(fib_radix_t *radix, const uint8_t *key, unsigned key_len,
+                      void *item);
+
+/**
+ * @brief   Gets the items stored under exactly a key
+ *
+ * @param[in] radix     the radix index
+ * @param[in] key       the key
+ * @param[in] key_len   length of @p key in bits
+ *
+ * @return  the node holding the first item, further items follow in
+ *          fib_radix_node_t::dup
+ * @return  NULL if no item is stored under @p key
+ */
+fib_radix_node_t *fib_radix_get(const fib_radix_t *radix, const uint8_t *key,
+                                unsigned key_len);
+
+/**
+ * @brief   Iterates the items stored under prefixes of a key
+ *
+ * Nodes are returned from the shortest to the longest prefix, so the last
+ * one returned holds the longest match.
+ *
+ * @param[in] radix     the radix index
+ * @param[in] last      the node returned by the previous call, NULL to start
+ * @param[in] key       the key
+ * @param[in] key_len   length of @p key in bits
+ *
+ * @return  the node holding the first item of the next matching prefix,
+ *          further items follow in fib_radix_node_t::dup
+ * @return  NULL if there are no more matching prefixes
+ */
+fib_radix_node_t *fib_radix_match(const fib_radix_t *radix,
+                                  const fib_radix_node_t *last,
+                                  const uint8_t *key, unsigned key_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_FIB_RADIX_H */
+/** @} */
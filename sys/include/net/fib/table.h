@@ -24,6 +24,9 @@
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
+#ifdef MODULE_FIB_RADIX
+#include "net/fib/radix.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,6 +95,18 @@ typedef struct {
     size_t entry_pool_size;
 } fib_sr_meta_t;
 
+/**
+ * @brief Lookup statistics of a FIB table
+ */
+typedef struct {
+    /** next hop and source route lookups */
+    uint32_t lookups;
+    /** lookups without a route to the destination */
+    uint32_t misses;
+    /** entries compared to a destination while searching the table */
+    uint32_t compared;
+} fib_stats_t;
+
 /**
 * @brief FIB table type for single hop entries
 */
@@ -133,6 +148,17 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** lookup statistics */
+    fib_stats_t stats;
+#if defined(MODULE_FIB_RADIX) || defined(DOXYGEN)
+    /** radix index of the entries, set fib_radix_t::nodes to use it.
+    *   Single hop entries are indexed by destination, source routes by
+    *   destination and by their hops.
+    */
+    fib_radix_t radix;
+    /** earliest point in time an indexed entry expires */
+    uint64_t next_expiry;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
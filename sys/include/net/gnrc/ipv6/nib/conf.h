@@ -256,6 +256,22 @@ extern "C" {
 #define GNRC_IPV6_NIB_NUMOF                 (4)
 #endif
 
+/**
+ * @brief   Index on-link entries by their address in a hash table
+ *
+ * Makes the neighbor cache lookup done for every sent or forwarded packet
+ * independent of @ref GNRC_IPV6_NIB_NUMOF, at the cost of one pointer per
+ * entry plus @ref GNRC_IPV6_NIB_NUMOF bucket pointers. Enabled by default for
+ * NIBs with more than 16 entries.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_ONL_HASH
+#if GNRC_IPV6_NIB_NUMOF > 16
+#define GNRC_IPV6_NIB_CONF_ONL_HASH         (1)
+#else
+#define GNRC_IPV6_NIB_CONF_ONL_HASH         (0)
+#endif
+#endif
+
 /**
  * @brief   Number of off-link entries in NIB
  *
@@ -266,6 +282,23 @@ extern "C" {
 #define GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Index off-link entries by their prefix in a binary trie
+ *
+ * Makes the longest-prefix match done by @ref gnrc_ipv6_nib_ft_get() for
+ * every forwarded packet depend on the prefix lengths in the forwarding table
+ * instead of @ref GNRC_IPV6_NIB_OFFL_NUMOF, at the cost of one pointer per
+ * entry plus 2 * @ref GNRC_IPV6_NIB_OFFL_NUMOF trie nodes. Enabled by default
+ * for NIBs with more than 16 off-link entries.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_FT_TRIE
+#if GNRC_IPV6_NIB_OFFL_NUMOF > 16
+#define GNRC_IPV6_NIB_CONF_FT_TRIE          (1)
+#else
+#define GNRC_IPV6_NIB_CONF_FT_TRIE          (0)
+#endif
+#endif
+
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
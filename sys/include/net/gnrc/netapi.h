@@ -54,6 +54,32 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_rtc   Run-to-completion extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Run-to-completion receive path for @ref net_gnrc_netapi
+ * @{
+ *
+ * @details The submodule `gnrc_netapi_rtc` lets the 6LoWPAN, IPv6 and UDP
+ *          layers register [callbacks](@ref net_gnrc_netapi_callbacks)
+ *          instead of their thread. A received packet then runs through these
+ *          layers in the context of the thread that dispatched it, usually
+ *          the interface's thread, up to the application's
+ *          @ref net_sock "sock" without any context switch in between.
+ *
+ * Everything that needs the state of a layer's thread is still handed over to
+ * the thread with a message: packets to send, 6LoWPAN fragments, ICMPv6
+ * (including neighbor discovery), IPv6 extension headers and packets to
+ * forward. The interface threads need stack for the receive handlers of all
+ * these layers, so the module doubles the default of @ref GNRC_NETIF_STACKSIZE.
+ *
+ * To use, add the module `gnrc_netapi_rtc` to the `USEMODULE` macro in your
+ * application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_rtc
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
@@ -119,6 +145,23 @@ typedef struct {
  */
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type);
 
+#if defined(MODULE_GNRC_NETAPI_RTC) || defined(DOXYGEN)
+/**
+ * @brief   Hands a packet a run-to-completion handler can not handle in the
+ *          caller's context over to the thread of its network module
+ *
+ * @note    Only available with @ref net_gnrc_netapi_rtc.
+ *
+ * @param[in] pid       PID of the network module's thread
+ * @param[in] cmd       @ref GNRC_NETAPI_MSG_TYPE_SND or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV
+ * @param[in] pkt       the packet, released if the thread's message queue is
+ *                      full
+ */
+void gnrc_netapi_rtc_defer(kernel_pid_t pid, uint16_t cmd,
+                           gnrc_pktsnip_t *pkt);
+#endif
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET or
  *          @ref GNRC_NETAPI_MSG_TYPE_SET messages and parsing the returned
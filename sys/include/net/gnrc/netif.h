@@ -41,6 +41,9 @@
 #include "net/gnrc/netif/dedup.h"
 #endif
 #include "net/gnrc/netif/flags.h"
+#ifdef MODULE_GNRC_NETIF_POLL
+#include "net/gnrc/netif/poll.h"
+#endif
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/netif/ipv6.h"
 #endif
@@ -74,6 +77,9 @@ typedef struct {
 #ifdef MODULE_NETSTATS_L2
     netstats_t stats;                       /**< transceiver's statistics */
 #endif
+#if defined(MODULE_GNRC_NETIF_POLL) || DOXYGEN
+    gnrc_netif_poll_t poll;                 /**< @ref net_gnrc_netif_poll state */
+#endif
 #if defined(MODULE_GNRC_IPV6) || DOXYGEN
     gnrc_netif_ipv6_t ipv6;                 /**< IPv6 component */
 #endif
@@ -46,6 +46,21 @@ extern "C" {
 #define GNRC_NETIF_PRIO            (THREAD_PRIORITY_MAIN - 5)
 #endif
 
+/**
+ * @brief   Default stack size for network interface threads
+ *
+ * With @ref net_gnrc_netapi_rtc the interface threads also run the receive
+ * handlers of the 6LoWPAN, IPv6 and UDP layers, so the default is doubled
+ * in that case.
+ */
+#ifndef GNRC_NETIF_STACKSIZE
+#ifdef MODULE_GNRC_NETAPI_RTC
+#define GNRC_NETIF_STACKSIZE       (2 * THREAD_STACKSIZE_DEFAULT)
+#else
+#define GNRC_NETIF_STACKSIZE       (THREAD_STACKSIZE_DEFAULT)
+#endif
+#endif
+
 /**
  * @brief       Message queue size for network interface threads
  *
@@ -57,6 +72,16 @@ extern "C" {
 #define GNRC_NETIF_MSG_QUEUE_SIZE  (16U)
 #endif
 
+/**
+ * @brief   Maximum number of frames an interface thread receives per device
+ *          event before it serves other messages
+ *
+ * @note    Only used with @ref net_gnrc_netif_poll.
+ */
+#ifndef GNRC_NETIF_RX_BUDGET
+#define GNRC_NETIF_RX_BUDGET       (16U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
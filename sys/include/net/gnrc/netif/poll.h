@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_poll    Budgeted receive polling
+ * @ingroup     net_gnrc_netif
+ * @brief       Coalesces device interrupts and drains received frames in
+ *              batches
+ *
+ * To activate, use `USEMODULE += gnrc_netif_poll` in your applications
+ * Makefile.
+ *
+ * Without this module every @ref NETDEV_EVENT_ISR of a device is posted to
+ * the interface thread as a message of its own. Under bursty traffic these
+ * messages fill up the thread's message queue (see
+ * @ref GNRC_NETIF_MSG_QUEUE_SIZE) and further interrupts are lost together
+ * with the frames they signal.
+ *
+ * With this module at most one such message is queued per interface. While
+ * it is pending or while the interface thread is serving the device, further
+ * interrupts only mark the device as ready again. The thread then calls the
+ * driver's netdev_driver_t::isr() until no interrupt is outstanding anymore
+ * or until @ref GNRC_NETIF_RX_BUDGET frames were received. Once the budget is
+ * exhausted the thread re-posts the event to itself, so that packets to send
+ * and option requests queued in the meantime are served in between.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Definitions for budgeted receive polling
+ */
+#ifndef NET_GNRC_NETIF_POLL_H
+#define NET_GNRC_NETIF_POLL_H
+
+#include <stdint.h>
+
+#include "net/gnrc/netif/conf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @name    Receive polling states
+ * @{
+ */
+#define GNRC_NETIF_POLL_IDLE        (0U)    /**< no interrupt outstanding */
+#define GNRC_NETIF_POLL_SCHEDULED   (1U)    /**< event message is queued */
+#define GNRC_NETIF_POLL_ACTIVE      (2U)    /**< thread serves the device */
+#define GNRC_NETIF_POLL_AGAIN       (3U)    /**< interrupt while serving */
+/** @} */
+
+/**
+ * @brief   Receive polling state and statistics of an interface
+ */
+typedef struct {
+    uint32_t events;            /**< interrupts signaled by the device */
+    uint32_t polls;             /**< event messages handled by the thread */
+    uint32_t frames;            /**< frames received by the thread */
+    uint32_t budget_exhausted;  /**< polls stopped by @ref GNRC_NETIF_RX_BUDGET */
+    uint32_t queue_drops;       /**< event messages lost to a full queue */
+    volatile uint8_t state;     /**< receive polling state */
+} gnrc_netif_poll_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_POLL_H */
+/** @} */
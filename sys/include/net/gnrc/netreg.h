@@ -10,6 +10,12 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * By default the entries of each protocol type are kept in a list that is
+ * searched linearly for a demultiplexing context. With the `gnrc_netreg_hash`
+ * module, an open-addressing hash index keyed by type and demultiplexing
+ * context finds the entries in constant time, which pays off with many
+ * registrations, e.g. hundreds of bound UDP ports.
  * @{
  *
  * @file
@@ -79,6 +85,19 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Number of slots in the hash index of the registry
+ *
+ * Each slot holds all entries of one (type, demux context) pair. Pairs that
+ * do not fit into the index anymore are kept in a list per type and looked
+ * up linearly, as without the index. Must be a power of two.
+ *
+ * @note    Only used with the `gnrc_netreg_hash` module.
+ */
+#ifndef GNRC_NETREG_HASH_SIZE
+#define GNRC_NETREG_HASH_SIZE       (32U)
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
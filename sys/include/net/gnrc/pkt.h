@@ -120,6 +120,17 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#if defined(MODULE_GNRC_PKTBUF_HEADROOM) || defined(DOXYGEN)
+    /**
+     * @brief   Unused bytes in front of the snip that the packet buffer
+     *          reserved for headers prepended to it
+     *
+     * @see     gnrc_pktbuf_add_headroom()
+     *
+     * @internal
+     */
+    uint16_t headroom;
+#endif
 } gnrc_pktsnip_t;
 
 /**
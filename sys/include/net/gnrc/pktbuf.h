@@ -58,6 +58,38 @@ extern "C" {
 #define GNRC_PKTBUF_SIZE    (6144)
 #endif  /* GNRC_PKTBUF_SIZE */
 
+/**
+ * @def     GNRC_PKTBUF_SLAB_SNIP_NUMOF
+ * @brief   Number of packet snip descriptors in the slab of gnrc_pktbuf_slab
+ *
+ * @details gnrc_pktbuf_slab serves descriptors and headers of up to 48 bytes
+ *          from slabs that come in addition to the @ref GNRC_PKTBUF_SIZE
+ *          bytes of its payload region. Once a slab is used up, further
+ *          allocations fall back to the region.
+ */
+#ifndef GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define GNRC_PKTBUF_SLAB_SNIP_NUMOF (32)
+#endif
+
+/**
+ * @def     GNRC_PKTBUF_SLAB_HDR_NUMOF
+ * @brief   Number of elements in each of the 16, 32 and 48 byte header slabs
+ *          of gnrc_pktbuf_slab
+ */
+#ifndef GNRC_PKTBUF_SLAB_HDR_NUMOF
+#define GNRC_PKTBUF_SLAB_HDR_NUMOF  (8)
+#endif
+
+/**
+ * @brief   Headroom to reserve with gnrc_pktbuf_add_headroom() for @p num
+ *          headers of @p bytes in total
+ *
+ * Covers the snips of the headers and the alignment padding of any packet
+ * buffer implementation.
+ */
+#define GNRC_PKTBUF_HEADROOM(num, bytes)    \
+    ((bytes) + ((num) * (sizeof(gnrc_pktsnip_t) + (4 * sizeof(void *)))))
+
 /**
  * @brief   Initializes packet buffer module.
  */
@@ -81,12 +113,47 @@ void gnrc_pktbuf_init(void);
  *                      be NULL.
  * @param[in] type      Protocol type of the gnrc_pktsnip_t.
  *
+ * @note    If @p next was allocated with gnrc_pktbuf_add_headroom() and its
+ *          headroom still fits the new snip, the new snip is placed in there
+ *          without calling the allocator.
+ *
  * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
  * @return  NULL, if no space is left in the packet buffer.
  */
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Adds a new gnrc_pktsnip_t and reserves space in front of it for
+ *          the headers lower layers will prepend.
+ *
+ * Headers prepended to the resulting snip with gnrc_pktbuf_add() take their
+ * snip and data from the reserved space as long as it suffices, which saves
+ * an allocation per header. The reserved space moves on to the prepended
+ * snip, so the next layer down can prepend its header the same way, and is
+ * returned to the packet buffer with the snip that holds it.
+ *
+ * Only gnrc_pktbuf_static reserves space and only with the
+ * `gnrc_pktbuf_headroom` module. Otherwise this function is equivalent to
+ * gnrc_pktbuf_add() and headers are allocated separately.
+ *
+ * @pre size < GNRC_PKTBUF_SIZE
+ *
+ * @param[in] next      Next gnrc_pktsnip_t in the packet. Leave NULL if you
+ *                      want to create a new packet.
+ * @param[in] data      Data of the new gnrc_pktsnip_t. If @p data is NULL no data
+ *                      will be inserted into `result`.
+ * @param[in] size      Length of @p data.
+ * @param[in] headroom  Space to reserve, see @ref GNRC_PKTBUF_HEADROOM
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_headroom(gnrc_pktsnip_t *next, const void *data,
+                                         size_t size, size_t headroom,
+                                         gnrc_nettype_t type);
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -68,6 +68,37 @@ extern "C" {
 #define GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_MS (3U * US_PER_SEC)
 #endif
 
+/**
+ * @brief   Number of hash buckets of the reassembly buffer
+ *
+ * Should be a power of 2 and at least @ref GNRC_SIXLOWPAN_FRAG_RBUF_SIZE.
+ *
+ * @note    Only applicable with `gnrc_sixlowpan_frag_rbuf_hash` module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+#define GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE  (8U)
+#endif
+
+/**
+ * @brief   Size of the virtual reassembly buffer
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_SIZE
+#define GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
+#endif
+
+/**
+ * @brief   Timeout for virtual reassembly buffer entries in microseconds
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module
+ */
+#ifndef GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US
+#define GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US  (GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_MS)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -14,6 +14,21 @@
  * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
  *          RFC 4944, section 5.3
  *      </a>
+ *
+ * By default, the reassembly buffer searches all its entries for the
+ * datagram of every fragment received and keeps the received parts of a
+ * datagram as a list of intervals, drawn from a pool shared by all entries.
+ *
+ * With `USEMODULE += gnrc_sixlowpan_frag_rbuf_hash` in your application's
+ * Makefile, entries are found by a hash of source and destination address,
+ * datagram size and tag instead (see @ref GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE).
+ * The received parts of a datagram are tracked in a bitmap per entry with
+ * one bit per 8 bytes, the unit of fragment offsets. Looking up the datagram
+ * of a fragment and detecting duplicate or overlapping fragments then takes
+ * the same time regardless of the number of datagrams and fragments in the
+ * buffer, and no shared pool can run out. Timed out entries are removed
+ * whenever a new datagram is added instead of on every fragment.
+ *
  * @{
  *
  * @file
@@ -85,6 +100,19 @@ typedef struct {
     uint16_t current_size;
 } gnrc_sixlowpan_rbuf_t;
 
+/**
+ * @brief   Statistics of the 6LoWPAN reassembly buffer
+ */
+typedef struct {
+    uint32_t evictions;     /**< incomplete datagrams removed to make room
+                             *   for a new one */
+    uint32_t timeouts;      /**< incomplete datagrams removed after
+                             *   @ref GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_MS */
+    uint32_t duplicates;    /**< fragments received more than once */
+    uint32_t overlaps;      /**< datagrams discarded due to overlapping
+                             *   fragments */
+} gnrc_sixlowpan_frag_rbuf_stats_t;
+
 /**
  * @brief   Definition of 6LoWPAN fragmentation type.
  */
@@ -93,6 +121,7 @@ typedef struct {
     uint16_t datagram_size; /**< Length of just the (uncompressed) IPv6 packet to be fragmented */
     uint16_t offset;        /**< Offset of the Nth fragment from the beginning of the
                              *   payload datagram */
+    uint16_t tag;           /**< Tag of the datagram */
 } gnrc_sixlowpan_msg_frag_t;
 
 /**
@@ -103,6 +132,13 @@ typedef struct {
  */
 gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get(void);
 
+/**
+ * @brief   Generates a new datagram tag for sending
+ *
+ * @return  A new datagram tag.
+ */
+uint16_t gnrc_sixlowpan_frag_next_tag(void);
+
 /**
  * @brief   Sends a packet fragmented
  *
@@ -134,6 +170,18 @@ void gnrc_sixlowpan_frag_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
  */
 void gnrc_sixlowpan_frag_rbuf_gc(void);
 
+/**
+ * @brief   Gets the statistics of the reassembly buffer
+ *
+ * @return  The statistics since startup or the last reset.
+ */
+const gnrc_sixlowpan_frag_rbuf_stats_t *gnrc_sixlowpan_frag_rbuf_stats(void);
+
+/**
+ * @brief   Resets the statistics of the reassembly buffer
+ */
+void gnrc_sixlowpan_frag_rbuf_reset_stats(void);
+
 /**
  * @brief   Sends a message to pass a further fragment down the network stack
  *
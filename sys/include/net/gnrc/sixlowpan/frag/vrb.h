@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_vrb Virtual reassembly buffer
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       Fragment forwarding without reassembly on intermediate routers
+ *
+ * To activate, use `USEMODULE += gnrc_sixlowpan_frag_vrb` in your
+ * applications Makefile.
+ *
+ * A router receiving the first fragment of a datagram not destined to itself
+ * decompresses only the IPv6 header, looks up the next hop in the NIB and
+ * forwards the fragment recompressed for the next link right away. The
+ * datagram is recorded as an entry of the virtual reassembly buffer (VRB),
+ * which maps the incoming link-layer source address and datagram tag to the
+ * outgoing interface, next hop and datagram tag. All subsequent fragments are
+ * forwarded with that label swapped in, without being copied into the packet
+ * buffer as a whole.
+ *
+ * Datagrams whose first fragment can not be forwarded this way (fragments
+ * received out of order, extension headers to be processed on every hop,
+ * routes over interfaces without 6LoWPAN, or a full VRB) are reassembled as
+ * before.
+ *
+ * @see [draft-ietf-lwig-6lowpan-virtual-reassembly-01]
+ *      (https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01)
+ *
+ * @{
+ *
+ * @file
+ * @brief       Virtual reassembly buffer definitions
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_VRB_H
+#define NET_GNRC_SIXLOWPAN_FRAG_VRB_H
+
+#include <stdint.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag.h"
+#include "net/ieee802154.h"
+#include "net/ipv6/hdr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   An entry of the virtual reassembly buffer
+ */
+typedef struct {
+    uint8_t src[IEEE802154_LONG_ADDRESS_LEN];       /**< incoming source address */
+    uint8_t out_dst[IEEE802154_LONG_ADDRESS_LEN];   /**< link-layer address of the next hop */
+    gnrc_netif_t *out_netif;                        /**< outgoing interface */
+    uint32_t arrival;                               /**< time in microseconds of
+                                                     *   arrival of the last fragment */
+    uint16_t datagram_size;                         /**< size of the datagram,
+                                                     *   0 for an unused entry */
+    uint16_t current_size;                          /**< bytes of the datagram
+                                                     *   forwarded so far */
+    uint16_t tag;                                   /**< incoming datagram tag */
+    uint16_t out_tag;                               /**< outgoing datagram tag */
+    uint8_t src_len;                                /**< length of gnrc_sixlowpan_frag_vrb_t::src */
+    uint8_t out_dst_len;                            /**< length of gnrc_sixlowpan_frag_vrb_t::out_dst */
+} gnrc_sixlowpan_frag_vrb_t;
+
+/**
+ * @brief   Statistics of the virtual reassembly buffer
+ */
+typedef struct {
+    uint32_t datagrams;     /**< datagrams forwarded without reassembly */
+    uint32_t fragments;     /**< fragments forwarded without reassembly */
+    uint32_t full;          /**< datagrams reassembled since the VRB was full */
+} gnrc_sixlowpan_frag_vrb_stats_t;
+
+/**
+ * @brief   Adds an entry for a datagram to be forwarded to the next hop
+ *          towards its destination
+ *
+ * Only unicast datagrams to other nodes, received on an interface with
+ * forwarding enabled and routed over an interface with 6LoWPAN header
+ * compression, are forwarded. Datagrams with extension headers that every
+ * hop has to process are not.
+ *
+ * @pre `(rbuf != NULL) && (rbuf->pkt != NULL) && (netif != NULL) &&
+ *       (hdr != NULL)`
+ *
+ * @param[in] rbuf      The reassembly buffer entry of the datagram, with
+ *                      its first fragment added.
+ * @param[in] netif     The interface the datagram was received on.
+ * @param[in] hdr       The decompressed IPv6 header of the datagram.
+ *
+ * @return  The new entry with a fresh outgoing datagram tag.
+ * @return  NULL, if the datagram is not to be forwarded or the VRB is full.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_route(const gnrc_sixlowpan_rbuf_t *rbuf,
+                                                              gnrc_netif_t *netif,
+                                                              const ipv6_hdr_t *hdr);
+
+/**
+ * @brief   Gets the entry of a datagram
+ *
+ * @param[in] src       Link-layer source address of the datagram.
+ * @param[in] src_len   Length of @p src.
+ * @param[in] tag       Tag of the datagram.
+ *
+ * @return  The entry of the datagram.
+ * @return  NULL, if the datagram is not forwarded by the VRB.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(const uint8_t *src,
+                                                       size_t src_len,
+                                                       uint16_t tag);
+
+/**
+ * @brief   Forwards a fragment of a datagram to the next hop
+ *
+ * The datagram tag of @p frag is replaced by
+ * gnrc_sixlowpan_frag_vrb_t::out_tag. The entry is removed once the whole
+ * datagram was forwarded.
+ *
+ * @pre `(vrbe != NULL) && (frag != NULL)`
+ *
+ * @param[in] vrbe      The entry of the datagram.
+ * @param[in] frag      The fragment in sending order, starting with the
+ *                      fragment header and without a @ref gnrc_netif_hdr_t.
+ *                      Will be released.
+ * @param[in] size      Number of bytes of the (uncompressed) datagram
+ *                      contained in @p frag.
+ *
+ * @return  0, on success.
+ * @return  -ENOMEM, if no @ref gnrc_netif_hdr_t could be allocated.
+ */
+int gnrc_sixlowpan_frag_vrb_forward(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                    gnrc_pktsnip_t *frag, size_t size);
+
+/**
+ * @brief   Removes an entry from the virtual reassembly buffer
+ *
+ * @param[in] vrbe  An entry. Must not be NULL.
+ */
+static inline void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    vrbe->datagram_size = 0;
+}
+
+/**
+ * @brief   Removes timed out entries from the virtual reassembly buffer
+ *
+ * @see @ref GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US
+ */
+void gnrc_sixlowpan_frag_vrb_gc(void);
+
+/**
+ * @brief   Gets the statistics of the virtual reassembly buffer
+ *
+ * @return  The statistics since startup or the last reset.
+ */
+const gnrc_sixlowpan_frag_vrb_stats_t *gnrc_sixlowpan_frag_vrb_stats(void);
+
+/**
+ * @brief   Resets the statistics of the virtual reassembly buffer
+ */
+void gnrc_sixlowpan_frag_vrb_reset_stats(void);
+
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Removes all entries from the virtual reassembly buffer
+ *
+ * @note    Only available when @ref TEST_SUITES is defined
+ */
+void gnrc_sixlowpan_frag_vrb_reset(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_VRB_H */
+/** @} */
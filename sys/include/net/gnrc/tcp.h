@@ -24,6 +24,7 @@
 
 #include <stdint.h>
 #include "net/gnrc/pkt.h"
+#include "net/gnrc/tcp/cc.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -122,6 +123,11 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, uint8_t address_family,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occured.
+ *       The function returns as soon as the data was sent and queued for
+ *       retransmission, it does not wait for the acknowledgment. Segments
+ *       are sent as long as the send window and the retransmit queue
+ *       (see @ref GNRC_TCP_RETRANSMIT_QUEUE_SIZE) allow. gnrc_tcp_close()
+ *       waits until all data was acknowledged.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
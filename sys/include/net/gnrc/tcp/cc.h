@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP congestion control
+ *
+ * A congestion control algorithm maintains gnrc_tcp_tcb_t::cwnd and
+ * gnrc_tcp_tcb_t::ssthresh of a connection. Data is only sent while the
+ * amount of unacknowledged data is below both the peers receive window and
+ * the congestion window. All callbacks are called by the FSM of the
+ * connection, gnrc_tcp_tcb_t::snd_una and gnrc_tcp_tcb_t::snd_nxt are up to
+ * date when they are called.
+ */
+
+#ifndef NET_GNRC_TCP_CC_H
+#define NET_GNRC_TCP_CC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681)
+ */
+#define GNRC_TCP_CC_DUP_ACK_THRESHOLD (3U)
+
+/**
+ * @brief Congestion control algorithm.
+ */
+struct gnrc_tcp_cc {
+    /**
+     * @brief Initializes the congestion state once the connection is established.
+     *
+     * @param[in,out] tcb   TCB holding the connection information.
+     */
+    void (*init)(gnrc_tcp_tcb_t *tcb);
+
+    /**
+     * @brief Handles an ACK acknowledging new data.
+     *
+     * @param[in,out] tcb     TCB holding the connection information.
+     * @param[in]     acked   Number of newly acknowledged bytes.
+     *
+     * @returns   true, if the first unacknowledged segment must be retransmitted now.
+     *            false otherwise.
+     */
+    bool (*ack)(gnrc_tcp_tcb_t *tcb, uint32_t acked);
+
+    /**
+     * @brief Handles a duplicate ACK.
+     *
+     * @param[in,out] tcb   TCB holding the connection information.
+     *
+     * @returns   true, if the first unacknowledged segment must be retransmitted now.
+     *            false otherwise.
+     */
+    bool (*dup_ack)(gnrc_tcp_tcb_t *tcb);
+
+    /**
+     * @brief Handles an expired retransmission timer, before the segment is retransmitted.
+     *
+     * @param[in,out] tcb   TCB holding the connection information.
+     */
+    void (*timeout)(gnrc_tcp_tcb_t *tcb);
+};
+
+/**
+ * @brief NewReno congestion control (RFC 5681, RFC 6582)
+ */
+extern const gnrc_tcp_cc_t gnrc_tcp_cc_newreno;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TCP_CC_H */
+/** @} */
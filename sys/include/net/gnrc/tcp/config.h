@@ -55,11 +55,27 @@ extern "C" {
 
 /**
  * @brief MSS Multiplicator = Number of MSS sized packets stored in receive buffer
+ *
+ * This is the receive window in segments as well. Of the segments that arrive behind
+ * a lost one, GNRC TCP holds one contiguous range and drops segments behind a second
+ * gap, so with a larger window a lossy link between two GNRC TCP nodes causes more
+ * retransmissions. tests/gnrc_tcp_cc measures the goodput for different windows.
  */
 #ifndef GNRC_TCP_MSS_MULTIPLICATOR
 #define GNRC_TCP_MSS_MULTIPLICATOR (1U)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged segments of a connection
+ *
+ * The number of segments in flight is limited by the peers receive window and
+ * the congestion window as well. A GNRC TCP peer drops segments behind a second
+ * gap in its window, they are sent again, see @ref GNRC_TCP_MSS_MULTIPLICATOR.
+ */
+#ifndef GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define GNRC_TCP_RETRANSMIT_QUEUE_SIZE (4U)
+#endif
+
 /**
  * @brief Default receive window size
  */
@@ -137,6 +153,16 @@ extern "C" {
 #define GNRC_TCP_PROBE_UPPER_BOUND (60U * US_PER_SEC)
 #endif
 
+/**
+ * @brief Congestion control algorithm used by connections, default is NewReno
+ *
+ * Set gnrc_tcp_tcb_t::cc after gnrc_tcp_tcb_init() to use another algorithm
+ * for a single connection.
+ */
+#ifndef GNRC_TCP_CC_DEFAULT
+#define GNRC_TCP_CC_DEFAULT (&gnrc_tcp_cc_newreno)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,7 @@
 #ifndef NET_GNRC_TCP_TCB_H
 #define NET_GNRC_TCP_TCB_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "kernel_types.h"
 #include "ringbuffer.h"
@@ -45,6 +46,32 @@ extern "C" {
  */
 #define GNRC_TCP_TCB_MBOX_SIZE (8U)
 
+/**
+ * @brief Congestion control algorithm, see net/gnrc/tcp/cc.h
+ */
+typedef struct gnrc_tcp_cc gnrc_tcp_cc_t;
+
+/**
+ * @brief Counters of a connection.
+ */
+typedef struct {
+    uint32_t retransmits;          /**< Segments retransmitted after a retransmission timeout */
+    uint32_t fast_retransmits;     /**< Segments retransmitted after duplicate ACKs */
+    uint32_t recovery_retransmits; /**< Segments retransmitted after partial ACKs below
+                                        recover, while recovering from a loss */
+    uint32_t dup_acks;             /**< Duplicate ACKs received */
+} gnrc_tcp_stats_t;
+
+/**
+ * @brief Entry of the retransmission queue.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;   /**< Sent segment */
+    uint32_t seq_end;      /**< Sequence number following the segment */
+    uint32_t sent;         /**< Timer value of the first transmission for rtt estimation */
+    bool retransmitted;    /**< Segment was retransmitted, its rtt is ambiguous */
+} gnrc_tcp_rtx_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -66,17 +93,26 @@ typedef struct _transmission_control_block {
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
     uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_held_seq; /**< Sequence number of out-of-order data held in rcv_buf */
+    uint16_t rcv_held;     /**< Length of out-of-order data held in rcv_buf */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
-    uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
-    uint8_t retries;       /**< Number of retransmissions */
+    uint8_t retries;       /**< Number of retransmissions of the oldest segment */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Highest sequence number sent when loss recovery started */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    const gnrc_tcp_cc_t *cc;   /**< Congestion control algorithm */
+    gnrc_tcp_stats_t stats;    /**< Counters of the connection */
     xtimer_t tim_tout;     /**< Timer struct for timeouts */
     msg_t msg_tout;        /**< Message, sent on timeouts */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    gnrc_tcp_rtx_t rtx[GNRC_TCP_RETRANSMIT_QUEUE_SIZE];  /**< Retransmit queue, oldest first */
+    uint8_t rtx_head;      /**< Index of the oldest segment in gnrc_tcp_tcb_t::rtx */
+    uint8_t rtx_len;       /**< Number of segments in gnrc_tcp_tcb_t::rtx */
     msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
     mbox_t mbox;             /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
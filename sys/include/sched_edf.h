@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_edf Earliest deadline first threads
+ * @ingroup     sys
+ * @brief       Periodic threads scheduled by earliest deadline first
+ *
+ * The deadline ordered run queue of @ref THREAD_PRIORITY_EDF is part of the
+ * kernel (`core_sched_edf`). This module creates periodic threads in that band
+ * and releases their jobs with xtimer.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Earliest deadline first thread interface
+ */
+
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdint.h>
+
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Creates a new periodic thread in the earliest deadline first class
+ *
+ * The thread runs at @ref THREAD_PRIORITY_EDF. Its first job is released on
+ * creation, every job has to complete within @p deadline microseconds of its
+ * release and ends with a call to thread_edf_wait_period().
+ *
+ * @param[out] stack    start address of the preallocated stack memory
+ * @param[in] stacksize the size of the thread's stack in bytes
+ * @param[in] period    job period in microseconds, must not be 0
+ * @param[in] deadline  relative deadline of each job in microseconds
+ * @param[in] flags     optional flags for the creation of the new thread
+ * @param[in] task_func pointer to the code that is executed in the new thread
+ * @param[in] arg       the argument to the function
+ * @param[in] name      a human readable descriptor for the thread
+ *
+ * @return              PID of newly created task on success
+ * @return              -EINVAL, if @p period is 0
+ * @return              -EOVERFLOW, if there are too many threads running already
+ */
+kernel_pid_t thread_create_edf(char *stack,
+                  int stacksize,
+                  uint32_t period,
+                  uint32_t deadline,
+                  int flags,
+                  thread_task_func_t task_func,
+                  void *arg,
+                  const char *name);
+
+/**
+ * @brief Completes the current job of an EDF thread
+ *
+ * Sleeps until the next period starts and moves the thread's deadline along.
+ * A job that completes after its deadline is counted as a deadline miss in
+ * @ref schedstat_t::deadline_misses. Periods that passed completely during an
+ * overrun are skipped. If thread_wakeup() wakes the thread up early, the
+ * pending release is dropped and the job keeps its deadline.
+ */
+void thread_edf_wait_period(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_round_robin Round robin scheduling
+ * @ingroup     sys
+ * @brief       Time slicing between threads of the same priority
+ *
+ * Without this module, threads of equal priority only switch voluntarily. A
+ * CPU-bound thread keeps all its peers from running until it blocks or
+ * calls thread_yield().
+ *
+ * With this module, a single xtimer rotates the run queue of the active
+ * thread's priority once the thread has used up @ref SCHED_RR_QUANTUM. The
+ * timer is only armed while at least one other thread of that priority is
+ * runnable. A system without contention never sets it.
+ *
+ * The earliest deadline first band of `core_sched_edf` is never rotated.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling interface
+ */
+
+#ifndef SCHED_ROUND_ROBIN_H
+#define SCHED_ROUND_ROBIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Time slice of a thread while others of its priority are runnable
+ *          in microseconds
+ */
+#ifndef SCHED_RR_QUANTUM
+#define SCHED_RR_QUANTUM        (10000U)
+#endif
+
+/**
+ * @brief   Arms or disarms the time slice timer for the active thread
+ *
+ * Called by the scheduler after every scheduling decision and whenever a
+ * thread becomes runnable, must be called with interrupts disabled.
+ */
+void sched_round_robin_update(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_ROUND_ROBIN_H */
+/** @} */
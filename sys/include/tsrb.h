@@ -15,7 +15,9 @@
  * @note        This ringbuffer implementation can be used without locking if
  *              there's only one producer and one consumer.
  *
- * @attention   Buffer size must be a power of two!
+ * The tsrb is a @ref spsc_ring.h "single producer, single consumer ring",
+ * so drivers can also use the zero-copy functions spsc_ring_reserve(),
+ * spsc_ring_commit(), spsc_ring_peek() and spsc_ring_consume() on it.
  *
  * @file
  * @brief       Thread-safe ringbuffer interface definition
@@ -26,9 +28,10 @@
 #ifndef TSRB_H
 #define TSRB_H
 
-#include <assert.h>
 #include <stddef.h>
 
+#include "spsc_ring.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,35 +39,22 @@ extern "C" {
 /**
  * @brief     thread-safe ringbuffer struct
  */
-typedef struct tsrb {
-    char *buf;                  /**< Buffer to operate on. */
-    unsigned int size;          /**< Size of buffer, must be power of 2. */
-    volatile unsigned reads;    /**< total number of reads */
-    volatile unsigned writes;   /**< total number of writes */
-} tsrb_t;
+typedef spsc_ring_t tsrb_t;
 
 /**
  * @brief Static initializer
  */
-#define TSRB_INIT(BUF) { (BUF), sizeof (BUF), 0, 0 }
+#define TSRB_INIT(BUF) SPSC_RING_INIT(BUF)
 
 /**
  * @brief        Initialize a tsrb.
  * @param[out]   rb        Datum to initialize.
  * @param[in]    buffer    Buffer to use by tsrb.
- * @param[in]    bufsize   `sizeof (buffer)`, must be power of 2.
+ * @param[in]    bufsize   `sizeof (buffer)`
  */
 static inline void tsrb_init(tsrb_t *rb, char *buffer, unsigned bufsize)
 {
-    /* make sure bufsize is a power of two.
-     * http://www.exploringbinary.com/ten-ways-to-check-if-an-integer-is-a-power-of-two-in-c/
-     */
-    assert((bufsize != 0) && ((bufsize & (~bufsize + 1)) == bufsize));
-
-    rb->buf = buffer;
-    rb->size = bufsize;
-    rb->reads = 0;
-    rb->writes = 0;
+    spsc_ring_init(rb, buffer, bufsize);
 }
 
 /**
@@ -75,7 +65,7 @@ static inline void tsrb_init(tsrb_t *rb, char *buffer, unsigned bufsize)
  */
 static inline int tsrb_empty(const tsrb_t *rb)
 {
-    return (rb->reads == rb->writes);
+    return spsc_ring_empty(rb);
 }
 
 
@@ -86,7 +76,7 @@ static inline int tsrb_empty(const tsrb_t *rb)
  */
 static inline unsigned int tsrb_avail(const tsrb_t *rb)
 {
-    return (rb->writes - rb->reads);
+    return spsc_ring_avail(rb);
 }
 
 /**
@@ -97,7 +87,7 @@ static inline unsigned int tsrb_avail(const tsrb_t *rb)
  */
 static inline int tsrb_full(const tsrb_t *rb)
 {
-    return (rb->writes - rb->reads) == rb->size;
+    return spsc_ring_full(rb);
 }
 
 /**
@@ -107,7 +97,7 @@ static inline int tsrb_full(const tsrb_t *rb)
  */
 static inline unsigned int tsrb_free(const tsrb_t *rb)
 {
-    return (rb->size - rb->writes + rb->reads);
+    return spsc_ring_free(rb);
 }
 
 /**
@@ -21,6 +21,17 @@
  * number of active timers.  The reason for this is that multiplexing is
  * realized by next-first singly linked lists.
  *
+ * On platforms with a 64 bit low-level timer (`TIMER_64BIT_HW`, e.g. native64
+ * and rocketchip64), xtimer uses 64 bit tick arithmetic throughout. There is
+ * no overflow handling and no list of long term timers, xtimer_now64() is a
+ * single read of the low-level timer.
+ *
+ * On these platforms, the optional
+ * `xtimer_wheel` module replaces the sorted lists by a hierarchical timing
+ * wheel. Insertion and removal then take constant time, timers are moved
+ * towards the lowest wheel level slot by slot as their target time approaches.
+ * See @ref XTIMER_WHEEL_BITS and @ref XTIMER_WHEEL_LEVELS for configuration.
+ *
  * @{
  * @file
  * @brief   xtimer interface definitions
@@ -98,6 +109,13 @@ typedef struct xtimer {
     xtimer_callback_t callback;  /**< callback function to call when timer
                                      expires */
     void *arg;                   /**< argument to pass to callback function */
+#if defined(MODULE_XTIMER_WHEEL) || defined(DOXYGEN)
+    struct xtimer **pprev;       /**< link pointing to this timer, only valid
+                                      while the timer is set (xtimer_wheel) */
+    uintptr_t cookie;            /**< marks @p pprev as valid, so timers on
+                                      the stack need no initialization
+                                      (xtimer_wheel) */
+#endif
 } xtimer_t;
 
 #else
@@ -576,6 +594,29 @@ void xtimer_set_timeout_flag(xtimer_t *t, uint32_t timeout);
 #define XTIMER_PERIODIC_RELATIVE (512)
 #endif
 
+#ifndef XTIMER_WHEEL_BITS
+/**
+ * @brief   Number of bits of the target time resolved per timing wheel level
+ *
+ * Each level of the `xtimer_wheel` backend has 2^XTIMER_WHEEL_BITS slots.
+ * The occupancy of a level is tracked in an `unsigned`, so this value must
+ * not exceed 5.
+ */
+#define XTIMER_WHEEL_BITS       (5U)
+#endif
+
+#ifndef XTIMER_WHEEL_LEVELS
+/**
+ * @brief   Number of timing wheel levels
+ *
+ * Timers further than 2^(XTIMER_WHEEL_BITS * XTIMER_WHEEL_LEVELS) ticks in the
+ * future are kept in an unsorted overflow list which is re-distributed to the
+ * wheel whenever the time crosses such a boundary. The default covers ~9.5
+ * hours at 1 MHz.
+ */
+#define XTIMER_WHEEL_LEVELS     (7U)
+#endif
+
 /*
  * Default xtimer configuration
  */
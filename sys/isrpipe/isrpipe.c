@@ -37,6 +37,15 @@ int isrpipe_write_one(isrpipe_t *isrpipe, char c)
     return res;
 }
 
+int isrpipe_write(isrpipe_t *isrpipe, const char *buf, size_t count)
+{
+    int res = tsrb_add(&isrpipe->tsrb, buf, count);
+
+    mutex_unlock(&isrpipe->mutex);
+
+    return res;
+}
+
 int isrpipe_read(isrpipe_t *isrpipe, char *buffer, size_t count)
 {
     int res;
@@ -63,6 +63,16 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     return ret;
 }
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+void gnrc_netapi_rtc_defer(kernel_pid_t pid, uint16_t cmd,
+                           gnrc_pktsnip_t *pkt)
+{
+    if (_gnrc_netapi_send_recv(pid, pkt, cmd) < 1) {
+        gnrc_pktbuf_release(pkt);
+    }
+}
+#endif
+
 #ifdef MODULE_GNRC_NETAPI_MBOX
 static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt)
 {
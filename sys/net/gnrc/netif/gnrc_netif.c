@@ -29,6 +29,7 @@
 #include "net/netstats.h"
 #endif
 #include "fmt.h"
+#include "irq.h"
 #include "log.h"
 #include "sched.h"
 
@@ -44,6 +45,9 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _configure_netdev(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+#ifdef MODULE_GNRC_NETIF_POLL
+static void _poll(gnrc_netif_t *netif);
+#endif
 
 gnrc_netif_t *gnrc_netif_create(char *stack, int stacksize, char priority,
                                 const char *name, netdev_t *netdev,
@@ -1322,7 +1326,11 @@ static void *_gnrc_netif_thread(void *args)
         switch (msg.type) {
             case NETDEV_MSG_TYPE_EVENT:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
+#ifdef MODULE_GNRC_NETIF_POLL
+                _poll(netif);
+#else
                 dev->driver->isr(dev);
+#endif
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
@@ -1384,6 +1392,71 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
+#ifdef MODULE_GNRC_NETIF_POLL
+static void _poll(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    uint32_t frames = netif->poll.frames;
+    unsigned state;
+    bool again;
+
+    netif->poll.polls++;
+    /* interrupts do not touch the state while the event message is queued */
+    netif->poll.state = GNRC_NETIF_POLL_ACTIVE;
+    do {
+        dev->driver->isr(dev);
+        state = irq_disable();
+        again = (netif->poll.state == GNRC_NETIF_POLL_AGAIN);
+        netif->poll.state = (again) ? GNRC_NETIF_POLL_ACTIVE
+                                    : GNRC_NETIF_POLL_IDLE;
+        irq_restore(state);
+    } while (again && ((netif->poll.frames - frames) < GNRC_NETIF_RX_BUDGET));
+    if (again) {
+        msg_t msg = { .type = NETDEV_MSG_TYPE_EVENT,
+                      .content = { .ptr = netif } };
+
+        /* budget exhausted: serve the messages queued in the meantime first
+         * and continue with the device afterwards */
+        netif->poll.budget_exhausted++;
+        netif->poll.state = GNRC_NETIF_POLL_SCHEDULED;
+        if (msg_send_to_self(&msg) <= 0) {
+            netif->poll.queue_drops++;
+            netif->poll.state = GNRC_NETIF_POLL_IDLE;
+        }
+    }
+}
+
+/**
+ * @brief   Posts the event message for an interrupt unless it is already
+ *          queued or being served
+ */
+static void _poll_isr(gnrc_netif_t *netif)
+{
+    unsigned state = irq_disable();
+    uint8_t prev = netif->poll.state;
+
+    netif->poll.events++;
+    if (prev == GNRC_NETIF_POLL_IDLE) {
+        netif->poll.state = GNRC_NETIF_POLL_SCHEDULED;
+    }
+    else if (prev == GNRC_NETIF_POLL_ACTIVE) {
+        netif->poll.state = GNRC_NETIF_POLL_AGAIN;
+    }
+    irq_restore(state);
+    /* otherwise coalesced with the queued or currently served event */
+    if (prev == GNRC_NETIF_POLL_IDLE) {
+        msg_t msg = { .type = NETDEV_MSG_TYPE_EVENT,
+                      .content = { .ptr = netif } };
+
+        if (msg_send(&msg, netif->pid) <= 0) {
+            netif->poll.queue_drops++;
+            netif->poll.state = GNRC_NETIF_POLL_IDLE;
+            puts("gnrc_netif: possibly lost interrupt.");
+        }
+    }
+}
+#endif /* MODULE_GNRC_NETIF_POLL */
+
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
     /* throw away packet if no one is interested */
@@ -1399,18 +1472,25 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
     gnrc_netif_t *netif = (gnrc_netif_t *) dev->context;
 
     if (event == NETDEV_EVENT_ISR) {
+#ifdef MODULE_GNRC_NETIF_POLL
+        _poll_isr(netif);
+#else
         msg_t msg = { .type = NETDEV_MSG_TYPE_EVENT,
                       .content = { .ptr = netif } };
 
         if (msg_send(&msg, netif->pid) <= 0) {
             puts("gnrc_netif: possibly lost interrupt.");
         }
+#endif
     }
     else {
         DEBUG("gnrc_netif: event triggered -> %i\n", event);
         gnrc_pktsnip_t *pkt = NULL;
         switch (event) {
             case NETDEV_EVENT_RX_COMPLETE:
+#ifdef MODULE_GNRC_NETIF_POLL
+                netif->poll.frames++;
+#endif
                 pkt = netif->ops->recv(netif);
                 if (pkt) {
                     _pass_on_packet(pkt);
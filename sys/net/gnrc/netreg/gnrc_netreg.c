@@ -16,6 +16,7 @@
 #include <string.h>
 
 #include "assert.h"
+#include "hashes.h"
 #include "log.h"
 #include "utlist.h"
 #include "net/gnrc/netreg.h"
@@ -31,10 +32,122 @@
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+#ifdef MODULE_GNRC_NETREG_HASH
+#define _INDEX_MASK     (GNRC_NETREG_HASH_SIZE - 1)
+
+/**
+ * @brief   Slot of the hash index, holds all entries of one
+ *          (type, demux_ctx) pair
+ */
+typedef struct {
+    gnrc_netreg_entry_t *head;  /**< entries of the pair, NULL if unused */
+    gnrc_nettype_t type;        /**< type of the entries */
+} _slot_t;
+
+/* The hash index, linear probing without tombstones */
+static _slot_t _index[GNRC_NETREG_HASH_SIZE];
+
+static inline unsigned _hash(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* Fibonacci hashing spreads consecutive ports over the index */
+    uint32_t hash = fibonacci_hash(demux_ctx ^ ((uint32_t)type << 24));
+
+    return (hash >> 16) & _INDEX_MASK;
+}
+
+static int _index_find(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    unsigned i = _hash(type, demux_ctx);
+
+    for (unsigned n = 0; n < GNRC_NETREG_HASH_SIZE; n++) {
+        _slot_t *slot = &_index[i];
+
+        if (slot->head == NULL) {
+            break;
+        }
+        if ((slot->type == type) && (slot->head->demux_ctx == demux_ctx)) {
+            return i;
+        }
+        i = (i + 1) & _INDEX_MASK;
+    }
+    return -1;
+}
+
+static int _index_add(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
+{
+    int idx = _index_find(type, entry->demux_ctx);
+
+    if (idx >= 0) {
+        LL_PREPEND(_index[idx].head, entry);
+        return 0;
+    }
+    /* keep the pair in the list of its type if it already lives there */
+    if (netreg[type] != NULL) {
+        gnrc_netreg_entry_t *tmp;
+
+        LL_SEARCH_SCALAR(netreg[type], tmp, demux_ctx, entry->demux_ctx);
+        if (tmp != NULL) {
+            return -1;
+        }
+    }
+    unsigned i = _hash(type, entry->demux_ctx);
+    for (unsigned n = 0; n < GNRC_NETREG_HASH_SIZE; n++) {
+        if (_index[i].head == NULL) {
+            entry->next = NULL;
+            _index[i].head = entry;
+            _index[i].type = type;
+            return 0;
+        }
+        i = (i + 1) & _INDEX_MASK;
+    }
+    return -1;
+}
+
+static void _index_remove(unsigned i)
+{
+    unsigned j = i;
+
+    /* move following slots up that would not be found anymore otherwise */
+    while (1) {
+        unsigned home;
+
+        _index[i].head = NULL;
+        do {
+            j = (j + 1) & _INDEX_MASK;
+            if (_index[j].head == NULL) {
+                return;
+            }
+            home = _hash(_index[j].type, _index[j].head->demux_ctx);
+        } while ((i <= j) ? ((i < home) && (home <= j))
+                          : ((i < home) || (home <= j)));
+        _index[i] = _index[j];
+        i = j;
+    }
+}
+
+static inline gnrc_netreg_entry_t *_first(gnrc_nettype_t type,
+                                          uint32_t demux_ctx)
+{
+    int idx = _index_find(type, demux_ctx);
+
+    return (idx >= 0) ? _index[idx].head : netreg[type];
+}
+#else
+static inline gnrc_netreg_entry_t *_first(gnrc_nettype_t type,
+                                          uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return netreg[type];
+}
+#endif
+
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+#ifdef MODULE_GNRC_NETREG_HASH
+    memset(_index, 0, sizeof(_index));
+#endif
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -59,6 +172,11 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+#ifdef MODULE_GNRC_NETREG_HASH
+    if (_index_add(type, entry) == 0) {
+        return 0;
+    }
+#endif
     LL_PREPEND(netreg[type], entry);
 
     return 0;
@@ -70,7 +188,21 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+#ifdef MODULE_GNRC_NETREG_HASH
+    int idx = _index_find(type, entry->demux_ctx);
+
+    if (idx >= 0) {
+        LL_DELETE(_index[idx].head, entry);
+        if (_index[idx].head == NULL) {
+            _index_remove(idx);
+        }
+        return;
+    }
+#endif
+    /* the entry may not be registered at all, e.g. by a closed sock */
+    if (netreg[type] != NULL) {
+        LL_DELETE(netreg[type], entry);
+    }
 }
 
 /**
@@ -92,7 +224,7 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next : _first(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
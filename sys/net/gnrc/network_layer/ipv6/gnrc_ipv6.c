@@ -53,6 +53,13 @@ static char _stack[GNRC_IPV6_STACK_SIZE];
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 
+#ifdef MODULE_FIB_RADIX
+/**
+ * @brief nodes of the radix index over the IPv6 forwarding table
+ */
+static fib_radix_node_t _fib_radix_nodes[FIB_RADIX_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE)];
+#endif
+
 /**
  * @brief the IPv6 forwarding table
  */
@@ -84,6 +91,10 @@ kernel_pid_t gnrc_ipv6_init(void)
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
+#ifdef MODULE_FIB_RADIX
+    gnrc_ipv6_fib_table.radix.nodes = _fib_radix_nodes;
+    gnrc_ipv6_fib_table.radix.nodes_numof = FIB_RADIX_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE);
+#endif
     fib_init(&gnrc_ipv6_fib_table);
 #endif
 
@@ -162,11 +173,60 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+/* ICMPv6 (neighbor discovery), extension headers (reassembly) and forwarding
+ * use the NIB and timers of the IPv6 thread, so leave them to it */
+static bool _rtc_receivable(gnrc_pktsnip_t *pkt)
+{
+    ipv6_hdr_t *hdr = pkt->data;
+
+    if ((pkt->size < sizeof(ipv6_hdr_t)) || !ipv6_hdr_is(hdr)) {
+        /* let _receive() drop it */
+        return true;
+    }
+    switch (hdr->nh) {
+        case PROTNUM_IPV6_EXT_HOPOPT:
+        case PROTNUM_IPV6_EXT_RH:
+        case PROTNUM_IPV6_EXT_FRAG:
+        case PROTNUM_IPV6_EXT_ESP:
+        case PROTNUM_IPV6_EXT_AH:
+        case PROTNUM_IPV6_EXT_DST:
+        case PROTNUM_IPV6_EXT_MOB:
+        case PROTNUM_ICMPV6:
+        case PROTNUM_IPV6_NONXT:
+            return false;
+        default:
+            break;
+    }
+    return ipv6_addr_is_loopback(&hdr->dst) ||
+           (gnrc_netif_get_by_ipv6_addr(&hdr->dst) != NULL);
+}
+
+static void _rtc_handler(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    if ((cmd == GNRC_NETAPI_MSG_TYPE_RCV) &&
+        (sched_active_pid != gnrc_ipv6_pid) && _rtc_receivable(pkt)) {
+        _receive(pkt);
+    }
+    else {
+        gnrc_netapi_rtc_defer(gnrc_ipv6_pid, cmd, pkt);
+    }
+}
+
+static gnrc_netreg_entry_cbd_t _rtc_cbd = { .cb = _rtc_handler };
+#endif
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_RTC
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_CB(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                           &_rtc_cbd);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
@@ -270,7 +330,11 @@ static gnrc_pktsnip_t *_create_netif_hdr(uint8_t *dst_l2addr,
                                          gnrc_pktsnip_t *pkt,
                                          uint8_t flags)
 {
-    gnrc_pktsnip_t *netif_hdr = gnrc_netif_hdr_build(NULL, 0, dst_l2addr, dst_l2addr_len);
+    /* prepend to pkt right away so the header can go into its headroom */
+    gnrc_pktsnip_t *netif_hdr = gnrc_pktbuf_add(pkt, NULL,
+                                                sizeof(gnrc_netif_hdr_t) +
+                                                dst_l2addr_len,
+                                                GNRC_NETTYPE_NETIF);
     gnrc_netif_hdr_t *hdr;
 
     if (netif_hdr == NULL) {
@@ -279,14 +343,15 @@ static gnrc_pktsnip_t *_create_netif_hdr(uint8_t *dst_l2addr,
         return NULL;
     }
     hdr = netif_hdr->data;
+    gnrc_netif_hdr_init(hdr, 0, dst_l2addr_len);
+    if ((dst_l2addr != NULL) && (dst_l2addr_len > 0)) {
+        gnrc_netif_hdr_set_dst_addr(hdr, dst_l2addr, dst_l2addr_len);
+    }
     /* previous netif header might have been allocated by some higher layer
      * to provide some flags (provided to us via netif_flags). */
     hdr->flags = flags;
 
-    /* add netif_hdr to front of the pkt list */
-    LL_PREPEND(pkt, netif_hdr);
-
-    return pkt;
+    return netif_hdr;
 }
 
 static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
@@ -17,6 +17,7 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "hashes.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -36,7 +37,30 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[GNRC_IPV6_NIB_NUMOF];
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+static _nib_onl_entry_t *_nodes_hash[GNRC_IPV6_NIB_NUMOF];
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
 static _nib_offl_entry_t _dsts[GNRC_IPV6_NIB_OFFL_NUMOF];
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+/**
+ * @brief   Node of the path-compressed prefix trie over _dsts
+ *
+ * A node either holds the off-link entries with exactly its prefix or
+ * branches into two sub-tries at bit _ft_node_t::pfx_len. With at most one
+ * branch node per distinct prefix 2 * GNRC_IPV6_NIB_OFFL_NUMOF nodes suffice.
+ */
+typedef struct _ft_node {
+    struct _ft_node *child[2];      /**< sub-tries by bit _ft_node_t::pfx_len */
+    _nib_offl_entry_t *entries;     /**< entries with _ft_node_t::pfx */
+    ipv6_addr_t pfx;                /**< prefix of the node */
+    uint8_t pfx_len;                /**< length of _ft_node_t::pfx in bits */
+} _ft_node_t;
+
+static _ft_node_t _ft_nodes[2 * GNRC_IPV6_NIB_OFFL_NUMOF];
+static _ft_node_t *_ft_root = NULL;
+static _ft_node_t *_ft_free = NULL;
+static unsigned _ft_nodes_used = 0;
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
 static _nib_dr_entry_t _def_routers[GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C
@@ -58,8 +82,16 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    memset(_nodes_hash, 0, sizeof(_nodes_hash));
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+    _ft_root = NULL;
+    _ft_free = NULL;
+    _ft_nodes_used = 0;
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* GNRC_IPV6_NIB_CONF_MULTIHOP_P6C */
@@ -75,27 +107,108 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
-_nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
+static _nib_onl_entry_t *_onl_match(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
 
-    DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
-          (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
-                                                     sizeof(addr_str)), iface);
     for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
         if ((_nib_onl_get_if(tmp) == iface) && _addr_equals(addr, tmp)) {
             /* exact match */
             DEBUG("  %p is an exact match\n", (void *)tmp);
-            node = tmp;
-            break;
+            return tmp;
         }
         if ((node == NULL) && (tmp->mode == _EMPTY)) {
-            DEBUG("  using %p\n", (void *)node);
+            DEBUG("  using %p\n", (void *)tmp);
             node = tmp;
         }
     }
+    return node;
+}
+
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+static inline _nib_onl_entry_t **_onl_bucket(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    hash = fibonacci_hash(hash) >> 16;
+    return &_nodes_hash[hash % GNRC_IPV6_NIB_NUMOF];
+}
+
+static void _onl_hash(_nib_onl_entry_t *node)
+{
+    _nib_onl_entry_t **ptr = _onl_bucket(&node->ipv6);
+
+    while ((*ptr != NULL) && (*ptr < node)) {
+        ptr = &(*ptr)->hash_next;
+    }
+    node->hash_next = *ptr;
+    *ptr = node;
+}
+
+void _nib_onl_unhash(_nib_onl_entry_t *node)
+{
+    for (_nib_onl_entry_t **ptr = _onl_bucket(&node->ipv6); *ptr != NULL;
+         ptr = &(*ptr)->hash_next) {
+        if (*ptr == node) {
+            *ptr = node->hash_next;
+            node->hash_next = NULL;
+            return;
+        }
+    }
+}
+
+static _nib_onl_entry_t *_onl_hash_match(const ipv6_addr_t *addr,
+                                         unsigned iface)
+{
+    /* same as _onl_match(): entries without an address on the interface
+     * match as well */
+    const ipv6_addr_t *keys[] = { addr, &ipv6_addr_unspecified };
+    _nib_onl_entry_t *node = NULL;
+
+    for (unsigned i = 0; i < (sizeof(keys) / sizeof(keys[0])); i++) {
+        for (_nib_onl_entry_t *tmp = *_onl_bucket(keys[i]); tmp != NULL;
+             tmp = tmp->hash_next) {
+            if ((_nib_onl_get_if(tmp) == iface) &&
+                ipv6_addr_equal(&tmp->ipv6, keys[i])) {
+                if ((node == NULL) || (tmp < node)) {
+                    node = tmp;
+                }
+                break;
+            }
+        }
+    }
+    if ((node == NULL) || (iface == 0)) {
+        /* cleared entries are on interface 0 without an address */
+        for (_nib_onl_entry_t *tmp = _nodes;
+             (tmp < (_nodes + GNRC_IPV6_NIB_NUMOF)) &&
+             ((node == NULL) || (tmp < node)); tmp++) {
+            if (tmp->mode == _EMPTY) {
+                node = tmp;
+                break;
+            }
+        }
+    }
+    DEBUG("  using %p\n", (void *)node);
+    return node;
+}
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+
+_nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
+{
+    _nib_onl_entry_t *node;
+
+    DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
+          (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
+                                                     sizeof(addr_str)), iface);
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    node = (addr != NULL) ? _onl_hash_match(addr, iface)
+                          : _onl_match(addr, iface);
+#else   /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+    node = _onl_match(addr, iface);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
     if (node != NULL) {
         _override_node(addr, iface, node);
     }
@@ -209,8 +322,13 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    for (_nib_onl_entry_t *node = *_onl_bucket(addr); node != NULL;
+         node = node->hash_next) {
+#else   /* GNRC_IPV6_NIB_CONF_ONL_HASH */
     for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
 
         if ((node->mode != _EMPTY) &&
             /* either requested or current interface undefined or
@@ -455,6 +573,190 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+static inline unsigned _ft_bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+static _ft_node_t *_ft_node_alloc(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _ft_node_t *node = _ft_free;
+
+    if (node != NULL) {
+        _ft_free = node->child[0];
+    }
+    else {
+        assert(_ft_nodes_used < (sizeof(_ft_nodes) / sizeof(_ft_nodes[0])));
+        node = &_ft_nodes[_ft_nodes_used++];
+    }
+    memset(node, 0, sizeof(_ft_node_t));
+    ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+    node->pfx_len = pfx_len;
+    return node;
+}
+
+static inline void _ft_node_free(_ft_node_t *node)
+{
+    node->child[0] = _ft_free;
+    _ft_free = node;
+}
+
+static _ft_node_t *_ft_get(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _ft_node_t *node = _ft_root;
+
+    while ((node != NULL) && (node->pfx_len < pfx_len)) {
+        node = node->child[_ft_bit(pfx, node->pfx_len)];
+    }
+    if ((node != NULL) && (node->pfx_len == pfx_len) &&
+        (ipv6_addr_match_prefix(&node->pfx, pfx) >= pfx_len)) {
+        return node;
+    }
+    return NULL;
+}
+
+static void _ft_insert(_nib_offl_entry_t *dst)
+{
+    _ft_node_t **ptr = &_ft_root;
+    _ft_node_t *node;
+    _nib_offl_entry_t **entry;
+
+    while ((node = *ptr) != NULL) {
+        unsigned match = ipv6_addr_match_prefix(&node->pfx, &dst->pfx);
+
+        match = (match > dst->pfx_len) ? dst->pfx_len : match;
+        if (match >= node->pfx_len) {
+            if (node->pfx_len == dst->pfx_len) {
+                break;
+            }
+            ptr = &node->child[_ft_bit(&dst->pfx, node->pfx_len)];
+            continue;
+        }
+        /* prefix diverges from or is shorter than the one of node */
+        _ft_node_t *leaf = _ft_node_alloc(&dst->pfx, dst->pfx_len);
+
+        if (match == dst->pfx_len) {
+            leaf->child[_ft_bit(&node->pfx, match)] = node;
+            *ptr = leaf;
+        }
+        else {
+            _ft_node_t *branch = _ft_node_alloc(&dst->pfx, match);
+
+            branch->child[_ft_bit(&dst->pfx, match)] = leaf;
+            branch->child[_ft_bit(&node->pfx, match)] = node;
+            *ptr = branch;
+        }
+        node = leaf;
+        break;
+    }
+    if (node == NULL) {
+        node = _ft_node_alloc(&dst->pfx, dst->pfx_len);
+        *ptr = node;
+    }
+    entry = &node->entries;
+    while ((*entry != NULL) && (*entry < dst)) {
+        entry = &(*entry)->trie_next;
+    }
+    dst->trie_next = *entry;
+    *entry = dst;
+}
+
+static void _ft_remove(_nib_offl_entry_t *dst)
+{
+    _ft_node_t **parent = NULL, **ptr = &_ft_root;
+    _ft_node_t *node;
+
+    while (((node = *ptr) != NULL) && (node->pfx_len < dst->pfx_len)) {
+        parent = ptr;
+        ptr = &node->child[_ft_bit(&dst->pfx, node->pfx_len)];
+    }
+    if ((node == NULL) || (node->pfx_len != dst->pfx_len)) {
+        return;
+    }
+    for (_nib_offl_entry_t **entry = &node->entries; *entry != NULL;
+         entry = &(*entry)->trie_next) {
+        if (*entry == dst) {
+            *entry = dst->trie_next;
+            dst->trie_next = NULL;
+            break;
+        }
+    }
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* node still holds entries or becomes a branch node */
+        return;
+    }
+    *ptr = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _ft_node_free(node);
+    if ((*ptr == NULL) && (parent != NULL) && ((*parent)->entries == NULL)) {
+        /* branch node above is left with a single sub-trie */
+        node = *parent;
+        *parent = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+        _ft_node_free(node);
+    }
+}
+
+static _nib_offl_entry_t *_ft_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+
+    for (const _ft_node_t *node = _ft_root; node != NULL;
+         node = node->child[_ft_bit(dst, node->pfx_len)]) {
+        /* prefixes of branch nodes are implicitly checked with the next node
+         * holding entries below them */
+        if (node->entries != NULL) {
+            if (ipv6_addr_match_prefix(&node->pfx, dst) < node->pfx_len) {
+                break;
+            }
+            for (_nib_offl_entry_t *entry = node->entries; entry != NULL;
+                 entry = entry->trie_next) {
+                if (entry->mode != _EMPTY) {
+                    DEBUG("nib: best match (%u bits)\n", node->pfx_len);
+                    res = entry;
+                    break;
+                }
+            }
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+    }
+    return res;
+}
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
+
+static inline bool _offl_equals(const _nib_offl_entry_t *dst,
+                                const ipv6_addr_t *next_hop, unsigned iface,
+                                const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    return (dst->pfx_len == pfx_len) &&                 /* prefix length matches and */
+           (dst->next_hop != NULL) &&                   /* there is a next hop that */
+           (_nib_onl_get_if(dst->next_hop) == iface) && /* has a matching interface and */
+           _addr_equals(next_hop, dst->next_hop) &&     /* equal address to next_hop, also */
+           (ipv6_addr_match_prefix(&dst->pfx, pfx) >= pfx_len); /* the prefix matches */
+}
+
+static _nib_offl_entry_t *_offl_reuse(_nib_offl_entry_t *dst,
+                                      const ipv6_addr_t *next_hop)
+{
+    _nib_onl_entry_t *node = dst->next_hop;
+
+    /* exact match (or next hop address was previously unset) */
+    DEBUG("  %p is an exact match\n", (void *)dst);
+    if (next_hop != NULL) {
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+        _nib_onl_unhash(node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+        memcpy(&node->ipv6, next_hop, sizeof(node->ipv6));
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+        _onl_hash(node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+    }
+    node->mode |= _DST;
+    return dst;
+}
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
@@ -469,27 +771,32 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
           iface);
     DEBUG("pfx = %s/%u)\n", ipv6_addr_to_str(addr_str, pfx,
                                              sizeof(addr_str)), pfx_len);
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+    _ft_node_t *node = _ft_get(pfx, pfx_len);
+
+    for (_nib_offl_entry_t *tmp = (node != NULL) ? node->entries : NULL;
+         tmp != NULL; tmp = tmp->trie_next) {
+        if (_offl_equals(tmp, next_hop, iface, pfx, pfx_len)) {
+            return _offl_reuse(tmp, next_hop);
+        }
+    }
+    for (unsigned i = 0; (dst == NULL) && (i < GNRC_IPV6_NIB_OFFL_NUMOF); i++) {
+        if (_dsts[i].next_hop == NULL) {
+            dst = &_dsts[i];
+        }
+    }
+#else   /* GNRC_IPV6_NIB_CONF_FT_TRIE */
     for (unsigned i = 0; i < GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
         _nib_offl_entry_t *tmp = &_dsts[i];
-        _nib_onl_entry_t *tmp_node = tmp->next_hop;
 
-        if ((tmp->pfx_len == pfx_len) &&                /* prefix length matches and */
-            (tmp_node != NULL) &&                       /* there is a next hop that */
-            (_nib_onl_get_if(tmp_node) == iface) &&     /* has a matching interface and */
-            _addr_equals(next_hop, tmp_node) &&         /* equal address to next_hop, also */
-            (ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len)) {  /* the prefix matches */
-            /* exact match (or next hop address was previously unset) */
-            DEBUG("  %p is an exact match\n", (void *)tmp);
-            if (next_hop != NULL) {
-                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
-            }
-            tmp->next_hop->mode |= _DST;
-            return tmp;
+        if (_offl_equals(tmp, next_hop, iface, pfx, pfx_len)) {
+            return _offl_reuse(tmp, next_hop);
         }
-        if ((dst == NULL) && (tmp_node == NULL)) {
+        if ((dst == NULL) && (tmp->next_hop == NULL)) {
             dst = tmp;
         }
     }
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
     if (dst != NULL) {
         DEBUG("  using %p\n", (void *)dst);
         dst->next_hop = _nib_onl_alloc(next_hop, iface);
@@ -502,6 +809,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+        _ft_insert(dst);
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
     }
     return dst;
 }
@@ -533,6 +843,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+        _ft_remove(dst);
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -558,11 +871,13 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
-    _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
-
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+    return _ft_match(dst);
+#else   /* GNRC_IPV6_NIB_CONF_FT_TRIE */
+    _nib_offl_entry_t *res = NULL;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -575,14 +890,15 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            if ((match >= entry->pfx_len) &&
+                ((res == NULL) || (entry->pfx_len > res->pfx_len))) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
             }
         }
     }
     return res;
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -640,6 +956,43 @@ int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
     return 0;
 }
 
+_nib_offl_entry_t *_nib_pl_get_on_link(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+
+#if GNRC_IPV6_NIB_CONF_FT_TRIE
+    /* all matching prefixes are on the path to dst, so take the entry first
+     * in _dsts from them */
+    for (const _ft_node_t *node = _ft_root; node != NULL;
+         node = node->child[_ft_bit(dst, node->pfx_len)]) {
+        if (node->entries != NULL) {
+            if (ipv6_addr_match_prefix(&node->pfx, dst) < node->pfx_len) {
+                break;
+            }
+            for (_nib_offl_entry_t *entry = node->entries;
+                 (entry != NULL) && ((res == NULL) || (entry < res));
+                 entry = entry->trie_next) {
+                if ((entry->mode & _PL) && (entry->flags & _PFX_ON_LINK)) {
+                    res = entry;
+                    break;
+                }
+            }
+        }
+        if (node->pfx_len == IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+    }
+#else   /* GNRC_IPV6_NIB_CONF_FT_TRIE */
+    while ((res = _nib_offl_iter(res))) {
+        if ((res->mode & _PL) && (res->flags & _PFX_ON_LINK) &&
+            (ipv6_addr_match_prefix(dst, &res->pfx) >= res->pfx_len)) {
+            break;
+        }
+    }
+#endif  /* GNRC_IPV6_NIB_CONF_FT_TRIE */
+    return res;
+}
+
 void _nib_pl_remove(_nib_offl_entry_t *nib_offl)
 {
     _nib_offl_remove(nib_offl, _PL);
@@ -808,11 +1161,17 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    _nib_onl_unhash(node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
     _nib_onl_clear(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    _onl_hash(node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
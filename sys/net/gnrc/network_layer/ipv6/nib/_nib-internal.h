@@ -91,6 +91,14 @@ extern "C" {
  */
 typedef struct _nib_onl_entry {
     struct _nib_onl_entry *next;        /**< next removable entry */
+#if GNRC_IPV6_NIB_CONF_ONL_HASH || defined(DOXYGEN)
+    /**
+     * @brief   next entry in the same address hash bucket
+     *
+     * @note    Only available if @ref GNRC_IPV6_NIB_CONF_ONL_HASH != 0.
+     */
+    struct _nib_onl_entry *hash_next;
+#endif
 #if GNRC_IPV6_NIB_CONF_QUEUE_PKT || defined(DOXYGEN)
     /**
      * @brief   queue for packets currently in address resolution
@@ -194,8 +202,16 @@ typedef struct {
 /**
  * @brief   Off-link NIB entry
  */
-typedef struct {
+typedef struct _nib_offl_entry {
     _nib_onl_entry_t *next_hop; /**< next hop to destination */
+#if GNRC_IPV6_NIB_CONF_FT_TRIE || defined(DOXYGEN)
+    /**
+     * @brief   next entry with the same prefix in the prefix trie
+     *
+     * @note    Only available if @ref GNRC_IPV6_NIB_CONF_FT_TRIE != 0.
+     */
+    struct _nib_offl_entry *trie_next;
+#endif
     ipv6_addr_t pfx;            /**< prefix to the destination */
     /**
      * @brief   Event for @ref GNRC_IPV6_NIB_PFX_TIMEOUT
@@ -304,6 +320,17 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if GNRC_IPV6_NIB_CONF_ONL_HASH || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the address hash table
+ *
+ * @note    Only available if @ref GNRC_IPV6_NIB_CONF_ONL_HASH != 0.
+ *
+ * @param[in,out] node  An entry. May not be in the hash table.
+ */
+void _nib_onl_unhash(_nib_onl_entry_t *node);
+#endif
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -315,6 +342,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+        _nib_onl_unhash(node);
+#endif
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -655,6 +685,17 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
  */
 void _nib_pl_remove(_nib_offl_entry_t *nib_offl);
 
+/**
+ * @brief   Gets the first on-link prefix list entry matching an address
+ *
+ * @param[in] dst   An IPv6 address. Must not be NULL.
+ *
+ * @return  The first prefix list entry flagged on-link with a prefix matching
+ *          @p dst.
+ * @return  NULL, if no such entry exists.
+ */
+_nib_offl_entry_t *_nib_pl_get_on_link(const ipv6_addr_t *dst);
+
 #if GNRC_IPV6_NIB_CONF_ROUTER || DOXYGEN
 /**
  * @brief   Creates or gets an existing forwarding table entry by its prefix
@@ -151,7 +151,7 @@ void gnrc_ipv6_nib_init_iface(gnrc_netif_t *netif)
 
 static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
 {
-    _nib_offl_entry_t *entry = NULL;
+    _nib_offl_entry_t *entry;
 
 #if GNRC_IPV6_NIB_CONF_6LN
     if (*iface != 0) {
@@ -160,12 +160,9 @@ static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
         }
     }
 #endif  /* GNRC_IPV6_NIB_CONF_6LN */
-    while ((entry = _nib_offl_iter(entry))) {
-        if ((entry->mode & _PL) && (entry->flags & _PFX_ON_LINK) &&
-            (ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len)) {
-            *iface = _nib_onl_get_if(entry->next_hop);
-            return true;
-        }
+    if ((entry = _nib_pl_get_on_link(dst)) != NULL) {
+        *iface = _nib_onl_get_if(entry->next_hop);
+        return true;
     }
     return ipv6_addr_is_link_local(dst);
 }
@@ -21,6 +21,9 @@
 #include "net/gnrc/netapi.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
 #include "net/gnrc/sixlowpan/internal.h"
 #include "net/gnrc/netif.h"
 #include "net/sixlowpan.h"
@@ -85,7 +88,8 @@ static gnrc_pktsnip_t *_build_frag_pkt(gnrc_pktsnip_t *pkt, size_t payload_len,
 }
 
 static uint16_t _send_1st_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
-                                   size_t payload_len, size_t datagram_size)
+                                   size_t payload_len, size_t datagram_size,
+                                   uint16_t tag)
 {
     gnrc_pktsnip_t *frag;
     uint16_t local_offset = 0;
@@ -113,7 +117,7 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
 
     hdr->disp_size = byteorder_htons((uint16_t)datagram_size);
     hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
-    hdr->tag = byteorder_htons(_tag);
+    hdr->tag = byteorder_htons(tag);
 
     /* Tell the link layer that we will send more fragments */
     gnrc_netif_hdr_t *netif_hdr = frag->data;
@@ -136,14 +140,14 @@ static uint16_t _send_1st_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
 
     DEBUG("6lo frag: send first fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", fragment size: %" PRIu16 ")\n",
-          (unsigned int)datagram_size, _tag, local_offset);
+          (unsigned int)datagram_size, tag, local_offset);
     gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
     return local_offset;
 }
 
 static uint16_t _send_nth_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
                                    size_t payload_len, size_t datagram_size,
-                                   uint16_t offset)
+                                   uint16_t offset, uint16_t tag)
 {
     gnrc_pktsnip_t *frag;
     /* since dispatches aren't supposed to go into subsequent fragments, we need not account
@@ -169,7 +173,7 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
     /* XXX: truncation of datagram_size > 4095 may happen here */
     hdr->disp_size = byteorder_htons((uint16_t)datagram_size);
     hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_N_DISP;
-    hdr->tag = byteorder_htons(_tag);
+    hdr->tag = byteorder_htons(tag);
     /* don't mention payload diff in offset */
     hdr->offset = (uint8_t)((offset + (datagram_size - payload_len)) >> 3);
     pkt = pkt->next;    /* don't copy netif header */
@@ -221,12 +225,17 @@ static uint16_t _send_nth_fragment(gnrc_netif_t *iface, gnrc_pktsnip_t *pkt,
     DEBUG("6lo frag: send subsequent fragment (datagram size: %u, "
           "datagram tag: %" PRIu16 ", offset: %" PRIu8 " (%u bytes), "
           "fragment size: %" PRIu16 ")\n",
-          (unsigned int)datagram_size, _tag, hdr->offset, hdr->offset << 3,
+          (unsigned int)datagram_size, tag, hdr->offset, hdr->offset << 3,
           local_offset);
     gnrc_sixlowpan_dispatch_send(frag, NULL, 0);
     return local_offset;
 }
 
+uint16_t gnrc_sixlowpan_frag_next_tag(void)
+{
+    return ++_tag;
+}
+
 gnrc_sixlowpan_msg_frag_t *gnrc_sixlowpan_msg_frag_get(void)
 {
     return (_fragment_msg.pkt == NULL) ? &_fragment_msg : NULL;
@@ -260,9 +269,10 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     /* Check whether to send the first or an Nth fragment */
     if (fragment_msg->offset == 0) {
         /* increment tag for successive, fragmented datagrams */
-        _tag++;
+        fragment_msg->tag = gnrc_sixlowpan_frag_next_tag();
         if ((res = _send_1st_fragment(iface, fragment_msg->pkt, payload_len,
-                                      fragment_msg->datagram_size)) == 0) {
+                                      fragment_msg->datagram_size,
+                                      fragment_msg->tag)) == 0) {
             /* error sending first fragment */
             DEBUG("6lo frag: error sending 1st fragment\n");
             goto error;
@@ -272,7 +282,8 @@ void gnrc_sixlowpan_frag_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     else if (fragment_msg->offset < payload_len) {
         if ((res = _send_nth_fragment(iface, fragment_msg->pkt, payload_len,
                                       fragment_msg->datagram_size,
-                                      fragment_msg->offset)) == 0) {
+                                      fragment_msg->offset,
+                                      fragment_msg->tag)) == 0) {
             /* error sending subsequent fragment */
             DEBUG("6lo frag: error sending subsequent fragment"
                   "(offset = %u)\n", fragment_msg->offset);
@@ -295,6 +306,47 @@ error:
     fragment_msg->pkt = NULL;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+/* forwards subsequent fragments of datagrams in the virtual reassembly
+ * buffer, returns false if the fragment is to be reassembled */
+static bool _vrb_forward(gnrc_netif_hdr_t *hdr, gnrc_pktsnip_t *pkt,
+                         uint16_t offset)
+{
+    sixlowpan_frag_t *frag = pkt->data;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    size_t size;
+
+    vrbe = gnrc_sixlowpan_frag_vrb_get(gnrc_netif_hdr_get_src_addr(hdr),
+                                       hdr->src_l2addr_len,
+                                       byteorder_ntohs(frag->tag));
+    if (vrbe == NULL) {
+        return false;
+    }
+    if ((offset == 0) ||
+        (vrbe->datagram_size != (byteorder_ntohs(frag->disp_size) &
+                                 SIXLOWPAN_FRAG_SIZE_MASK))) {
+        /* a first fragment is routed anew and a different size means the tag
+         * was reused for a new datagram */
+        DEBUG("6lo vrb: new datagram with tag %u, remove entry\n",
+              vrbe->tag);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        return false;
+    }
+    size = (pkt->size > sizeof(sixlowpan_frag_n_t)) ?
+           (pkt->size - sizeof(sixlowpan_frag_n_t)) : 0;
+    if ((size == 0) || ((offset + size) > vrbe->datagram_size)) {
+        DEBUG("6lo vrb: fragment too big for datagram, discarding datagram\n");
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    /* remove link-layer header of the previous hop */
+    pkt = gnrc_pktbuf_remove_snip(pkt, pkt->next);
+    gnrc_sixlowpan_frag_vrb_forward(vrbe, pkt, size);
+    return true;
+}
+#endif
+
 void gnrc_sixlowpan_frag_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
 {
     gnrc_netif_hdr_t *hdr = pkt->next->data;
@@ -317,12 +369,20 @@ void gnrc_sixlowpan_frag_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
             return;
     }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    if (_vrb_forward(hdr, pkt, offset)) {
+        return;
+    }
+#endif
     rbuf_add(hdr, pkt, offset, page);
 }
 
 void gnrc_sixlowpan_frag_rbuf_gc(void)
 {
     rbuf_gc();
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_gc();
+#endif
 }
 
 void gnrc_sixlowpan_frag_rbuf_remove(gnrc_sixlowpan_rbuf_t *rbuf)
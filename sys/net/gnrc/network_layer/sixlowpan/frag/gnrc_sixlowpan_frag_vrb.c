@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/gnrc/sixlowpan/internal.h"
+#include "net/protnum.h"
+#include "utlist.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+
+static gnrc_sixlowpan_frag_vrb_t _vrb[GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+static gnrc_sixlowpan_frag_vrb_stats_t _stats;
+
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+static inline bool _entry_empty(const gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    return (vrbe->datagram_size == 0);
+}
+
+static inline bool _timed_out(const gnrc_sixlowpan_frag_vrb_t *vrbe,
+                              uint32_t now_usec)
+{
+    return ((now_usec - vrbe->arrival) > GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US);
+}
+
+/* checks whether the datagram is routed to another node, i.e. whether
+ * gnrc_ipv6 would forward it after reassembly */
+static bool _forwardable(gnrc_netif_t *netif, const ipv6_hdr_t *hdr)
+{
+    bool rtr;
+
+    gnrc_netif_acquire(netif);
+    rtr = gnrc_netif_is_rtr(netif);
+    gnrc_netif_release(netif);
+    return rtr && (hdr->hl > 1) &&
+           /* extension headers that are processed on every hop */
+           (hdr->nh != PROTNUM_IPV6_EXT_HOPOPT) &&
+           (hdr->nh != PROTNUM_IPV6_EXT_RH) &&
+           !ipv6_addr_is_multicast(&hdr->dst) &&
+           !ipv6_addr_is_link_local(&hdr->dst) &&
+           !ipv6_addr_is_link_local(&hdr->src) &&
+           (gnrc_netif_get_by_ipv6_addr(&hdr->dst) == NULL);
+}
+
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_route(const gnrc_sixlowpan_rbuf_t *rbuf,
+                                                              gnrc_netif_t *netif,
+                                                              const ipv6_hdr_t *hdr)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_netif_t *out_netif;
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t now_usec;
+
+    assert((rbuf != NULL) && (rbuf->pkt != NULL) && (netif != NULL) &&
+           (hdr != NULL));
+    if (!_forwardable(netif, hdr)) {
+        return NULL;
+    }
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(&hdr->dst, NULL, NULL, &nce) < 0) {
+        DEBUG("6lo vrb: no route to %s\n",
+              ipv6_addr_to_str(addr_str, &hdr->dst, sizeof(addr_str)));
+        return NULL;
+    }
+    out_netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+    if ((out_netif == NULL) || !gnrc_netif_is_6ln(out_netif) ||
+        !(out_netif->flags & GNRC_NETIF_FLAGS_6LO_HC) ||
+        (out_netif->sixlo.max_frag_size == 0) ||
+        (nce.l2addr_len > IEEE802154_LONG_ADDRESS_LEN)) {
+        DEBUG("6lo vrb: route to %s not over 6LoWPAN\n",
+              ipv6_addr_to_str(addr_str, &hdr->dst, sizeof(addr_str)));
+        return NULL;
+    }
+    now_usec = xtimer_now_usec();
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (!_entry_empty(&_vrb[i]) && _timed_out(&_vrb[i], now_usec)) {
+            gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
+        }
+        if ((vrbe == NULL) && _entry_empty(&_vrb[i])) {
+            vrbe = &_vrb[i];
+        }
+    }
+    if (vrbe == NULL) {
+        DEBUG("6lo vrb: virtual reassembly buffer full\n");
+        _stats.full++;
+        return NULL;
+    }
+    memcpy(vrbe->src, rbuf->src, rbuf->src_len);
+    vrbe->src_len = rbuf->src_len;
+    memcpy(vrbe->out_dst, nce.l2addr, nce.l2addr_len);
+    vrbe->out_dst_len = nce.l2addr_len;
+    vrbe->out_netif = out_netif;
+    vrbe->arrival = now_usec;
+    vrbe->datagram_size = rbuf->pkt->size;
+    vrbe->current_size = 0;
+    vrbe->tag = rbuf->tag;
+    vrbe->out_tag = gnrc_sixlowpan_frag_next_tag();
+    DEBUG("6lo vrb: forward datagram (tag %u, size %u) to %s over interface "
+          "%u with tag %u\n", vrbe->tag, vrbe->datagram_size,
+          ipv6_addr_to_str(addr_str, &hdr->dst, sizeof(addr_str)),
+          out_netif->pid, vrbe->out_tag);
+    return vrbe;
+}
+
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(const uint8_t *src,
+                                                       size_t src_len,
+                                                       uint16_t tag)
+{
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+
+        if (!_entry_empty(vrbe) && (vrbe->tag == tag) &&
+            (vrbe->src_len == src_len) &&
+            (memcmp(vrbe->src, src, src_len) == 0)) {
+            if (_timed_out(vrbe, xtimer_now_usec())) {
+                DEBUG("6lo vrb: entry (tag %u) timed out\n", vrbe->tag);
+                gnrc_sixlowpan_frag_vrb_rm(vrbe);
+                return NULL;
+            }
+            return vrbe;
+        }
+    }
+    return NULL;
+}
+
+int gnrc_sixlowpan_frag_vrb_forward(gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                    gnrc_pktsnip_t *frag, size_t size)
+{
+    sixlowpan_frag_t *hdr = frag->data;
+    gnrc_pktsnip_t *netif;
+    gnrc_netif_hdr_t *netif_hdr;
+
+    assert((vrbe != NULL) && (frag != NULL));
+    netif = gnrc_netif_hdr_build(NULL, 0, vrbe->out_dst, vrbe->out_dst_len);
+    if (netif == NULL) {
+        DEBUG("6lo vrb: error allocating link-layer header\n");
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        gnrc_pktbuf_release(frag);
+        return -ENOMEM;
+    }
+    netif_hdr = netif->data;
+    netif_hdr->if_pid = vrbe->out_netif->pid;
+    hdr->tag = byteorder_htons(vrbe->out_tag);
+    LL_PREPEND(frag, netif);
+    if (vrbe->current_size == 0) {
+        _stats.datagrams++;
+    }
+    vrbe->current_size += size;
+    _stats.fragments++;
+    if (vrbe->current_size >= vrbe->datagram_size) {
+        DEBUG("6lo vrb: datagram (tag %u) forwarded completely\n", vrbe->tag);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    }
+    else {
+        /* Tell the link layer that we will send more fragments */
+        netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+        vrbe->arrival = xtimer_now_usec();
+    }
+    gnrc_sixlowpan_dispatch_send(netif, NULL, 0);
+    return 0;
+}
+
+void gnrc_sixlowpan_frag_vrb_gc(void)
+{
+    uint32_t now_usec = xtimer_now_usec();
+
+    for (unsigned i = 0; i < GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        if (!_entry_empty(&_vrb[i]) && _timed_out(&_vrb[i], now_usec)) {
+            DEBUG("6lo vrb: entry (tag %u) timed out\n", _vrb[i].tag);
+            gnrc_sixlowpan_frag_vrb_rm(&_vrb[i]);
+        }
+    }
+}
+
+const gnrc_sixlowpan_frag_vrb_stats_t *gnrc_sixlowpan_frag_vrb_stats(void)
+{
+    return &_stats;
+}
+
+void gnrc_sixlowpan_frag_vrb_reset_stats(void)
+{
+    memset(&_stats, 0, sizeof(_stats));
+}
+
+#ifdef TEST_SUITES
+void gnrc_sixlowpan_frag_vrb_reset(void)
+{
+    memset(_vrb, 0, sizeof(_vrb));
+}
+#endif
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+
+/** @} */
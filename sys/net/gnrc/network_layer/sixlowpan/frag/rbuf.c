@@ -25,6 +25,7 @@
 #include "thread.h"
 #include "xtimer.h"
 #include "utlist.h"
+#include "bitfield.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -36,6 +37,14 @@
 #define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+#if (RBUF_SIZE > UINT8_MAX) || (GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE > UINT8_MAX)
+#error "gnrc_sixlowpan_frag_rbuf_hash supports at most 255 entries and buckets"
+#endif
+
+/* index + 1 of the first entry in a hash bucket, 0 for none */
+static uint8_t _buckets[GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE];
+#else
 #ifndef RBUF_INT_SIZE
 /* same as ((int) ceil((double) N / D)) */
 #define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
@@ -43,8 +52,10 @@
 #endif
 
 static rbuf_int_t rbuf_int[RBUF_INT_SIZE];
+#endif
 
 static rbuf_t rbuf[RBUF_SIZE];
+static gnrc_sixlowpan_frag_rbuf_stats_t _stats;
 
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
@@ -54,12 +65,14 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
+#ifndef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
 /* checks whether start and end overlaps, but not identical to, given interval i */
 static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end);
 /* gets a free entry from interval buffer */
 static rbuf_int_t *_rbuf_int_get_free(void);
-/* update interval buffer of entry */
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size);
+#endif
+/* records the fragment as received in entry, returns RBUF_UPDATE_* */
+static int _rbuf_update(rbuf_t *entry, uint16_t offset, size_t frag_size);
 /* gets an entry identified by its tupel */
 static rbuf_t *_rbuf_get(const void *src, size_t src_len,
                          const void *dst, size_t dst_len,
@@ -75,6 +88,14 @@ enum {
     RBUF_ADD_REPEAT,
 };
 
+/* status codes for _rbuf_update() */
+enum {
+    RBUF_UPDATE_NEW,        /* fragment was not received yet */
+    RBUF_UPDATE_DUPLICATE,  /* fragment was already received */
+    RBUF_UPDATE_OVERLAP,    /* fragment partially overlaps a received one */
+    RBUF_UPDATE_ERROR,      /* fragment could not be recorded */
+};
+
 void rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
               size_t offset, unsigned page)
 {
@@ -88,16 +109,19 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
 {
     rbuf_t *entry;
     sixlowpan_frag_n_t *frag = pkt->data;
-    rbuf_int_t *ptr;
     uint8_t *data = ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
     size_t frag_size;
+    int update;
 
     /* check if provided offset is the same as in fragment */
     assert(((((frag->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK) ==
                 SIXLOWPAN_FRAG_1_DISP)) && (offset == 0)) ||
            ((((frag->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK) ==
                 SIXLOWPAN_FRAG_N_DISP)) && (offset == (frag->offset * 8U))));
+#ifndef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+    /* the hashed buffer collects timed out entries when it adds a new one */
     rbuf_gc();
+#endif
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                       gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
                       byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
@@ -109,8 +133,6 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    ptr = entry->ints;
-
     /* dispatches in the first fragment are ignored */
     if (offset == 0) {
         frag_size = pkt->size - sizeof(sixlowpan_frag_t);
@@ -131,30 +153,29 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    /* If the fragment overlaps another fragment and differs in either the size
-     * or the offset of the overlapped fragment, discards the datagram
-     * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
-            DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
-            gnrc_pktbuf_release(entry->super.pkt);
-            rbuf_rm(entry);
-
-            /* "A fresh reassembly may be commenced with the most recently
-             * received link fragment"
-             * https://tools.ietf.org/html/rfc4944#section-5.3 */
-            return RBUF_ADD_REPEAT;
-        }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer");
-            gnrc_pktbuf_release(pkt);
-            return RBUF_ADD_SUCCESS;
-        }
-        ptr = ptr->next;
+    update = _rbuf_update(entry, offset, frag_size);
+    if (update == RBUF_UPDATE_OVERLAP) {
+        /* If the fragment overlaps another fragment and differs in either the
+         * size or the offset of the overlapped fragment, discards the datagram
+         * https://tools.ietf.org/html/rfc4944#section-5.3 */
+        DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
+        _stats.overlaps++;
+        gnrc_pktbuf_release(entry->super.pkt);
+        rbuf_rm(entry);
+
+        /* "A fresh reassembly may be commenced with the most recently
+         * received link fragment"
+         * https://tools.ietf.org/html/rfc4944#section-5.3 */
+        return RBUF_ADD_REPEAT;
+    }
+    if (update == RBUF_UPDATE_DUPLICATE) {
+        DEBUG("6lo rbuf: fragment already in reassembly buffer");
+        _stats.duplicates++;
+        gnrc_pktbuf_release(pkt);
+        return RBUF_ADD_SUCCESS;
     }
 
-    if (_rbuf_update_ints(entry, offset, frag_size)) {
+    if (update == RBUF_UPDATE_NEW) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry->super.current_size += (uint16_t)frag_size;
         if (offset == 0) {
@@ -185,6 +206,80 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     return RBUF_ADD_SUCCESS;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+/* index + 1 of entry, as used in the hash buckets */
+static inline uint8_t _rbuf_idx(const rbuf_t *entry)
+{
+    return (uint8_t)(entry - rbuf) + 1;
+}
+
+static uint32_t _fnv1a(uint32_t hash, const uint8_t *data, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ data[i]) * 16777619U;
+    }
+    return hash;
+}
+
+static uint8_t _rbuf_hash(const void *src, size_t src_len,
+                          const void *dst, size_t dst_len,
+                          size_t size, uint16_t tag)
+{
+    const uint8_t key[] = { (uint8_t)(tag >> 8), (uint8_t)tag,
+                            (uint8_t)(size >> 8), (uint8_t)size };
+    uint32_t hash = 2166136261U;
+
+    hash = _fnv1a(hash, key, sizeof(key));
+    hash = _fnv1a(hash, src, src_len);
+    hash = _fnv1a(hash, dst, dst_len);
+    return hash % GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE;
+}
+
+static int _rbuf_update(rbuf_t *entry, uint16_t offset, size_t frag_size)
+{
+    /* fragments start at a unit boundary, only the last one of a datagram
+     * may end within a unit */
+    unsigned first = offset / 8U, last;
+    unsigned received = 0;
+    bool starts_within = false;
+
+    if (frag_size == 0) {
+        return RBUF_UPDATE_ERROR;
+    }
+    last = (offset + frag_size - 1) / 8U;
+    for (unsigned i = first; i <= last; i++) {
+        if (bf_isset(entry->received, i)) {
+            received++;
+        }
+        if ((i != first) && bf_isset(entry->starts, i)) {
+            starts_within = true;
+        }
+    }
+    if (received == 0) {
+        for (unsigned i = first; i <= last; i++) {
+            bf_set(entry->received, i);
+        }
+        bf_set(entry->starts, first);
+        DEBUG("6lo rfrag: add units (%u, %u) to entry (%s, ", first, last,
+              gnrc_netif_addr_to_str(entry->super.src, entry->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->super.dst,
+                                                      entry->super.dst_len,
+                                                      l2addr_str),
+              (unsigned)entry->super.pkt->size, entry->super.tag);
+        return RBUF_UPDATE_NEW;
+    }
+    /* identical to a fragment received before: it started at the same unit
+     * and ended with the same unit */
+    if ((received == (last - first + 1)) && bf_isset(entry->starts, first) &&
+        !starts_within &&
+        (((last + 1) >= RBUF_UNITS) || !bf_isset(entry->received, last + 1) ||
+         bf_isset(entry->starts, last + 1))) {
+        return RBUF_UPDATE_DUPLICATE;
+    }
+    return RBUF_UPDATE_OVERLAP;
+}
+#else
 static inline bool _rbuf_int_overlap_partially(rbuf_int_t *i, uint16_t start, uint16_t end)
 {
     /* start and ends are both inclusive, so using <= for both */
@@ -203,30 +298,27 @@ static rbuf_int_t *_rbuf_int_get_free(void)
     return NULL;
 }
 
-void rbuf_rm(rbuf_t *entry)
+static int _rbuf_update(rbuf_t *entry, uint16_t offset, size_t frag_size)
 {
-    while (entry->ints != NULL) {
-        rbuf_int_t *next = entry->ints->next;
+    rbuf_int_t *new, *ptr = entry->ints;
+    uint16_t end = (uint16_t)(offset + frag_size - 1);
 
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
+    while (ptr != NULL) {
+        if (_rbuf_int_overlap_partially(ptr, offset, end)) {
+            return RBUF_UPDATE_OVERLAP;
+        }
+        /* End was already checked in overlap check */
+        if (ptr->start == offset) {
+            return RBUF_UPDATE_DUPLICATE;
+        }
+        ptr = ptr->next;
     }
 
-    entry->super.pkt = NULL;
-}
-
-static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
-{
-    rbuf_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
-
     new = _rbuf_int_get_free();
 
     if (new == NULL) {
         DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
+        return RBUF_UPDATE_ERROR;
     }
 
     new->start = offset;
@@ -243,7 +335,37 @@ static bool _rbuf_update_ints(rbuf_t *entry, uint16_t offset, size_t frag_size)
 
     LL_PREPEND(entry->ints, new);
 
-    return true;
+    return RBUF_UPDATE_NEW;
+}
+#endif
+
+void rbuf_rm(rbuf_t *entry)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+    if (!rbuf_entry_empty(entry)) {
+        uint8_t *link = &_buckets[entry->hash];
+
+        while (*link != 0) {
+            if (*link == _rbuf_idx(entry)) {
+                *link = entry->next;
+                break;
+            }
+            link = &rbuf[*link - 1].next;
+        }
+        entry->next = 0;
+    }
+#else
+    while (entry->ints != NULL) {
+        rbuf_int_t *next = entry->ints->next;
+
+        entry->ints->start = 0;
+        entry->ints->end = 0;
+        entry->ints->next = NULL;
+        entry->ints = next;
+    }
+#endif
+
+    entry->super.pkt = NULL;
 }
 
 void rbuf_gc(void)
@@ -265,57 +387,61 @@ void rbuf_gc(void)
                                          l2addr_str),
                   (unsigned)rbuf[i].super.pkt->size, rbuf[i].super.tag);
 
+            _stats.timeouts++;
             gnrc_pktbuf_release(rbuf[i].super.pkt);
             rbuf_rm(&(rbuf[i]));
         }
     }
 }
 
-static inline void _set_rbuf_timeout(void)
+const gnrc_sixlowpan_frag_rbuf_stats_t *gnrc_sixlowpan_frag_rbuf_stats(void)
 {
-    xtimer_set_msg(&_gc_timer, RBUF_TIMEOUT, &_gc_timer_msg, sched_active_pid);
+    return &_stats;
 }
 
-static rbuf_t *_rbuf_get(const void *src, size_t src_len,
-                         const void *dst, size_t dst_len,
-                         size_t size, uint16_t tag, unsigned page)
+void gnrc_sixlowpan_frag_rbuf_reset_stats(void)
 {
-    rbuf_t *res = NULL, *oldest = NULL;
-    uint32_t now_usec = xtimer_now_usec();
+    memset(&_stats, 0, sizeof(_stats));
+}
 
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].super.pkt != NULL) && (rbuf[i].super.pkt->size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.pkt->size, rbuf[i].super.tag);
-            rbuf[i].arrival = now_usec;
-            _set_rbuf_timeout();
-            return &(rbuf[i]);
-        }
+static inline void _set_rbuf_timeout(void)
+{
+    xtimer_set_msg(&_gc_timer, RBUF_TIMEOUT, &_gc_timer_msg, sched_active_pid);
+}
 
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && rbuf_entry_empty(&rbuf[i])) {
-            res = &(rbuf[i]);
-        }
+static inline bool _rbuf_matches(const rbuf_t *entry,
+                                 const void *src, size_t src_len,
+                                 const void *dst, size_t dst_len,
+                                 size_t size, uint16_t tag)
+{
+    return (entry->super.pkt != NULL) && (entry->super.pkt->size == size) &&
+           (entry->super.tag == tag) && (entry->super.src_len == src_len) &&
+           (entry->super.dst_len == dst_len) &&
+           (memcmp(entry->super.src, src, src_len) == 0) &&
+           (memcmp(entry->super.dst, dst, dst_len) == 0);
+}
 
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) || (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
-        }
-    }
+static rbuf_t *_rbuf_found(rbuf_t *entry, uint32_t now_usec)
+{
+    DEBUG("6lo rfrag: entry %p (%s, ", (void *)entry,
+          gnrc_netif_addr_to_str(entry->super.src, entry->super.src_len,
+                                 l2addr_str));
+    DEBUG("%s, %u, %u) found\n",
+          gnrc_netif_addr_to_str(entry->super.dst, entry->super.dst_len,
+                                 l2addr_str),
+          (unsigned)entry->super.pkt->size, entry->super.tag);
+    entry->arrival = now_usec;
+    _set_rbuf_timeout();
+    return entry;
+}
 
+/* evicts oldest if res is NULL and sets up res for a new datagram */
+static rbuf_t *_rbuf_new(rbuf_t *res, rbuf_t *oldest,
+                         const void *src, size_t src_len,
+                         const void *dst, size_t dst_len,
+                         size_t size, uint16_t tag, unsigned page,
+                         uint32_t now_usec)
+{
     /* entry not in buffer and no empty spot found */
     if (res == NULL) {
         assert(oldest != NULL);
@@ -323,6 +449,7 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
          * oldest could have been picked as res) */
         assert(!rbuf_entry_empty(oldest));
         DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
+        _stats.evictions++;
         gnrc_pktbuf_release(oldest->super.pkt);
         rbuf_rm(oldest);
         res = oldest;
@@ -370,11 +497,90 @@ static rbuf_t *_rbuf_get(const void *src, size_t src_len,
     return res;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+static rbuf_t *_rbuf_get(const void *src, size_t src_len,
+                         const void *dst, size_t dst_len,
+                         size_t size, uint16_t tag, unsigned page)
+{
+    rbuf_t *res = NULL, *oldest = NULL;
+    uint32_t now_usec = xtimer_now_usec();
+    uint8_t hash = _rbuf_hash(src, src_len, dst, dst_len, size, tag);
+
+    for (unsigned i = _buckets[hash]; i != 0; i = rbuf[i - 1].next) {
+        rbuf_t *entry = &rbuf[i - 1];
+
+        if (_rbuf_matches(entry, src, src_len, dst, dst_len, size, tag)) {
+            if ((now_usec - entry->arrival) <= RBUF_TIMEOUT) {
+                return _rbuf_found(entry, now_usec);
+            }
+            /* timed out, rbuf_gc() below removes it */
+            break;
+        }
+    }
+
+    /* new datagram: collect timed out entries and search a free one */
+    rbuf_gc();
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+        if (rbuf_entry_empty(&rbuf[i])) {
+            res = &(rbuf[i]);
+            break;
+        }
+        /* note that xtimer_now will overflow in ~1.2 hours */
+        if ((oldest == NULL) || (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
+            oldest = &(rbuf[i]);
+        }
+    }
+    res = _rbuf_new(res, oldest, src, src_len, dst, dst_len, size, tag, page,
+                    now_usec);
+    if (res != NULL) {
+        memset(res->received, 0, sizeof(res->received));
+        memset(res->starts, 0, sizeof(res->starts));
+        res->hash = hash;
+        res->next = _buckets[hash];
+        _buckets[hash] = _rbuf_idx(res);
+    }
+    return res;
+}
+#else
+static rbuf_t *_rbuf_get(const void *src, size_t src_len,
+                         const void *dst, size_t dst_len,
+                         size_t size, uint16_t tag, unsigned page)
+{
+    rbuf_t *res = NULL, *oldest = NULL;
+    uint32_t now_usec = xtimer_now_usec();
+
+    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+        /* check first if entry already available */
+        if (_rbuf_matches(&rbuf[i], src, src_len, dst, dst_len, size, tag)) {
+            return _rbuf_found(&rbuf[i], now_usec);
+        }
+
+        /* if there is a free spot: remember it */
+        if ((res == NULL) && rbuf_entry_empty(&rbuf[i])) {
+            res = &(rbuf[i]);
+        }
+
+        /* remember oldest slot */
+        /* note that xtimer_now will overflow in ~1.2 hours */
+        if ((oldest == NULL) || (oldest->arrival - rbuf[i].arrival < UINT32_MAX / 2)) {
+            oldest = &(rbuf[i]);
+        }
+    }
+
+    return _rbuf_new(res, oldest, src, src_len, dst, dst_len, size, tag, page,
+                     now_usec);
+}
+#endif
+
 #ifdef TEST_SUITES
 void rbuf_reset(void)
 {
     xtimer_remove(&_gc_timer);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+    memset(_buckets, 0, sizeof(_buckets));
+#else
     memset(rbuf_int, 0, sizeof(rbuf_int));
+#endif
     for (unsigned int i = 0; i < RBUF_SIZE; i++) {
         if ((rbuf[i].super.pkt != NULL) &&
             (rbuf[i].super.pkt->users > 0)) {
@@ -382,6 +588,7 @@ void rbuf_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(&_stats, 0, sizeof(_stats));
 }
 
 const rbuf_t *rbuf_array(void)
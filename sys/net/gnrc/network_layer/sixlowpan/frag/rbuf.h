@@ -22,6 +22,7 @@
 #include <inttypes.h>
 #include <stdbool.h>
 
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 
@@ -40,6 +41,14 @@ extern "C" {
 #define RBUF_TIMEOUT        (GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_MS)
 /** @} */
 
+/**
+ * @brief   Number of 8-byte units of the largest datagram
+ *
+ * Fragment offsets are given in units of 8 bytes, so fragments start at a
+ * unit boundary.
+ */
+#define RBUF_UNITS          ((SIXLOWPAN_FRAG_MAX_LEN + 7) / 8)
+
 /**
  * @brief   Fragment intervals to identify limits of fragments.
  *
@@ -69,7 +78,36 @@ typedef struct rbuf_int {
  */
 typedef struct {
     gnrc_sixlowpan_rbuf_t super;        /**< exposed part of the reassembly buffer */
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   8-byte units of the datagram covered by received fragments
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rbuf_hash`
+     */
+    BITFIELD(received, RBUF_UNITS);
+    /**
+     * @brief   8-byte units received fragments start at
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rbuf_hash`
+     */
+    BITFIELD(starts, RBUF_UNITS);
+    /**
+     * @brief   Index + 1 of the next entry in the same hash bucket, 0 for
+     *          none
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rbuf_hash`
+     */
+    uint8_t next;
+    /**
+     * @brief   Hash bucket of the entry
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_rbuf_hash`
+     */
+    uint8_t hash;
+#endif
+#if !defined(MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH) || defined(DOXYGEN)
     rbuf_int_t *ints;                   /**< intervals of the fragment */
+#endif
     uint32_t arrival;                   /**< time in microseconds of arrival of
                                          *   last received fragment */
 } rbuf_t;
@@ -124,7 +162,7 @@ static inline bool rbuf_entry_empty(const rbuf_t *rbuf) {
 
 #if defined(TEST_SUITES) || defined(DOXYGEN)
 /**
- * @brief   Resets the packet buffer to a clean state
+ * @brief   Resets the packet buffer and its statistics to a clean state
  *
  * @note    Only available when @ref TEST_SUITES is defined
  */
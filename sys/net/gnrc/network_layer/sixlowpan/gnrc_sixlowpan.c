@@ -301,11 +301,38 @@ static void _send(gnrc_pktsnip_t *pkt)
     gnrc_sixlowpan_multiplex_by_size(pkt, datagram_size, netif, 0);
 }
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+static void _rtc_handler(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    if ((cmd == GNRC_NETAPI_MSG_TYPE_RCV) && (sched_active_pid != _pid)
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+        /* the reassembly buffer belongs to the 6LoWPAN thread, which also
+         * times out incomplete datagrams */
+        && ((pkt->type != GNRC_NETTYPE_SIXLOWPAN) || (pkt->size == 0) ||
+            !sixlowpan_frag_is(pkt->data))
+#endif
+       ) {
+        _receive(pkt);
+    }
+    else {
+        gnrc_netapi_rtc_defer(_pid, cmd, pkt);
+    }
+}
+
+static gnrc_netreg_entry_cbd_t _rtc_cbd = { .cb = _rtc_handler };
+#endif
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_RTC
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_CB(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                           &_rtc_cbd);
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_SIXLOWPAN_MSG_QUEUE_SIZE);
@@ -25,6 +25,9 @@
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
 #include "net/gnrc/sixlowpan/internal.h"
 #include "net/sixlowpan.h"
 #include "utlist.h"
@@ -216,6 +219,85 @@ static size_t _iphc_nhc_udp_decode(gnrc_pktsnip_t *sixlo, size_t offset,
 }
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+static bool _iphc_encode(gnrc_pktsnip_t *pkt);
+
+/* forwards the first fragment of a datagram routed to another node,
+ * recompressed for the next link, instead of reassembling the datagram.
+ * frag_size is the number of bytes of the datagram in that fragment */
+static bool _vrb_forward_frag1(gnrc_sixlowpan_rbuf_t *rbuf,
+                               gnrc_netif_t *iface, size_t frag_size)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    gnrc_pktsnip_t *netif, *ipv6, *payload, *frag;
+    uint8_t *data = rbuf->pkt->data;
+    sixlowpan_frag_t *frag_hdr;
+
+    if ((iface == NULL) || (rbuf->current_size != frag_size) ||
+        (frag_size >= rbuf->pkt->size)) {
+        /* subsequent fragments were received first or the datagram is
+         * already complete */
+        return false;
+    }
+    vrbe = gnrc_sixlowpan_frag_vrb_from_route(rbuf, iface,
+                                              (ipv6_hdr_t *)data);
+    if (vrbe == NULL) {
+        return false;
+    }
+    /* copy headers and payload of the fragment in sending order */
+    payload = gnrc_pktbuf_add(NULL, data + sizeof(ipv6_hdr_t),
+                              frag_size - sizeof(ipv6_hdr_t),
+                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        goto error;
+    }
+    ipv6 = gnrc_pktbuf_add(payload, data, sizeof(ipv6_hdr_t),
+                           GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(payload);
+        goto error;
+    }
+    netif = gnrc_netif_hdr_build(NULL, 0, vrbe->out_dst, vrbe->out_dst_len);
+    if (netif == NULL) {
+        gnrc_pktbuf_release(ipv6);
+        goto error;
+    }
+    ((gnrc_netif_hdr_t *)netif->data)->if_pid = vrbe->out_netif->pid;
+    LL_PREPEND(ipv6, netif);
+    ((ipv6_hdr_t *)ipv6->data)->hl--;
+    if (!_iphc_encode(netif)) {
+        goto error;
+    }
+    if ((gnrc_pkt_len(netif->next) + sizeof(sixlowpan_frag_t)) >
+        vrbe->out_netif->sixlo.max_frag_size) {
+        DEBUG("6lo iphc: recompressed first fragment too big for next link\n");
+        gnrc_pktbuf_release(netif);
+        goto error;
+    }
+    frag = gnrc_pktbuf_add(netif->next, NULL, sizeof(sixlowpan_frag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        gnrc_pktbuf_release(netif);
+        goto error;
+    }
+    /* gnrc_sixlowpan_frag_vrb_forward() adds the link-layer header */
+    netif->next = NULL;
+    gnrc_pktbuf_release(netif);
+    frag_hdr = frag->data;
+    frag_hdr->disp_size = byteorder_htons((uint16_t)rbuf->pkt->size);
+    frag_hdr->disp_size.u8[0] |= SIXLOWPAN_FRAG_1_DISP;
+    gnrc_sixlowpan_frag_vrb_forward(vrbe, frag, frag_size);
+    gnrc_pktbuf_release(rbuf->pkt);
+    gnrc_sixlowpan_frag_rbuf_remove(rbuf);
+    return true;
+
+error:
+    DEBUG("6lo iphc: unable to forward first fragment, reassemble datagram\n");
+    gnrc_sixlowpan_frag_vrb_rm(vrbe);
+    return false;
+}
+#endif
+
 static inline void _recv_error_release(gnrc_pktsnip_t *sixlo,
                                        gnrc_pktsnip_t *ipv6,
                                        gnrc_sixlowpan_rbuf_t *rbuf) {
@@ -578,6 +660,13 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
            sixlo->size - payload_offset);
     if (rbuf != NULL) {
         rbuf->current_size += (uncomp_hdr_len - payload_offset);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+        if (_vrb_forward_frag1(rbuf, iface, uncomp_hdr_len + sixlo->size -
+                                            payload_offset)) {
+            gnrc_pktbuf_release(sixlo);
+            return;
+        }
+#endif
         gnrc_sixlowpan_frag_rbuf_dispatch_when_complete(rbuf, netif_hdr);
     }
     else {
@@ -654,9 +743,10 @@ static inline bool _compressible(gnrc_pktsnip_t *hdr)
     }
 }
 
-void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
+/* compresses the headers of pkt in sending order in place, pkt is released
+ * on error */
+static bool _iphc_encode(gnrc_pktsnip_t *pkt)
 {
-    assert(pkt != NULL);
     gnrc_netif_hdr_t *netif_hdr = pkt->data;
     ipv6_hdr_t *ipv6_hdr;
     gnrc_netif_t *iface = gnrc_netif_hdr_get_netif(netif_hdr);
@@ -665,11 +755,8 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     gnrc_pktsnip_t *dispatch, *ptr = pkt->next;
     bool addr_comp = false;
     size_t dispatch_size = 0;
-    /* datagram size before compression */
-    size_t orig_datagram_size = gnrc_pkt_len(pkt->next);
     uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
 
-    (void)ctx;
     dispatch = NULL;    /* use dispatch as temporary pointer for prev */
     /* determine maximum dispatch size and write protect all headers until
      * then because they will be removed */
@@ -681,7 +768,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
             if (addr_comp) {    /* addr_comp was used as release indicator */
                 gnrc_pktbuf_release(pkt);
             }
-            return;
+            return false;
         }
         ptr = tmp;
         if (dispatch == NULL) {
@@ -715,7 +802,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     if (dispatch == NULL) {
         DEBUG("6lo iphc: error allocating dispatch space\n");
         gnrc_pktbuf_release(pkt);
-        return;
+        return false;
     }
 
     iphc_hdr = dispatch->data;
@@ -843,7 +930,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
                 gnrc_pktbuf_release(pkt);
-                return;
+                return false;
             }
             gnrc_netif_release(iface);
 
@@ -962,7 +1049,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
         if (gnrc_netif_hdr_ipv6_iid_from_dst(iface, netif_hdr, &iid) < 0) {
             DEBUG("6lo iphc: could not get destination's IID\n");
             gnrc_pktbuf_release(pkt);
-            return;
+            return false;
         }
 
         if ((ipv6_hdr->dst.u64[1].u64 == iid.uint64.u64) ||
@@ -1010,7 +1097,7 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
                 if (udp == NULL) {
                     DEBUG("gnrc_sixlowpan_iphc_encode: unable to mark UDP header\n");
                     gnrc_pktbuf_release(dispatch);
-                    return;
+                    return false;
                 }
             }
             gnrc_pktbuf_remove_snip(pkt, udp);
@@ -1031,10 +1118,22 @@ void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
     /* insert dispatch into packet */
     dispatch->next = pkt->next;
     pkt->next = dispatch;
+    return true;
+}
 
-    gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(netif_hdr);
-    assert(netif != NULL);
-    gnrc_sixlowpan_multiplex_by_size(pkt, orig_datagram_size, netif, page);
+void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page)
+{
+    assert(pkt != NULL);
+    /* datagram size before compression */
+    size_t orig_datagram_size = gnrc_pkt_len(pkt->next);
+
+    (void)ctx;
+    if (_iphc_encode(pkt)) {
+        gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(pkt->data);
+
+        assert(netif != NULL);
+        gnrc_sixlowpan_multiplex_by_size(pkt, orig_datagram_size, netif, page);
+    }
 }
 
 /** @} */
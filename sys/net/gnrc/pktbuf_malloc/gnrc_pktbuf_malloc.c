@@ -74,6 +74,9 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+    pkt->headroom = 0;
+#endif
 }
 
 void gnrc_pktbuf_init(void)
@@ -99,6 +102,15 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_add_headroom(gnrc_pktsnip_t *next, const void *data,
+                                         size_t size, size_t headroom,
+                                         gnrc_nettype_t type)
+{
+    /* headers are allocated separately */
+    (void)headroom;
+    return gnrc_pktbuf_add(next, data, size, type);
+}
+
 static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *header;
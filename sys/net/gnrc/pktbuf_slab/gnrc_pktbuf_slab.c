@@ -0,0 +1,844 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer with size-class slabs and a TLSF payload region
+ *
+ * Packet snip descriptors and small headers come from fixed-size slabs (see
+ * @ref sys_memarray). Larger data, and anything a full slab can not take,
+ * comes from a region managed by a two-level segregated fit (TLSF)
+ * allocator, which finds a fitting block and merges freed blocks with their
+ * neighbors in constant time.
+ *
+ * gnrc_pktbuf_mark() leaves the larger part of the data in place, so the
+ * data of a snip may start anywhere within its slab element or region
+ * block. Both are therefore looked up by address: slab elements by their
+ * index and region blocks with a bitmap that marks every block header.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "bitarithm.h"
+#include "memarray.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#if GNRC_PKTBUF_SIZE > 0xffff
+#error "gnrc_pktbuf_slab: GNRC_PKTBUF_SIZE must be below 64 KiB"
+#endif
+
+#define ALIGNMENT           (8U)
+#define ALIGN(size)         (((size) + ALIGNMENT - 1) & ~(ALIGNMENT - 1))
+
+/* number of second level lists per power of two */
+#define SL_LOG2             (2U)
+#define SL_COUNT            (1U << SL_LOG2)
+/* smallest power of two a block size can have, sizes below are never used */
+#define FL_SHIFT            (4U)
+#define FL_COUNT            (16U - FL_SHIFT)
+
+/* set in _hdr_t::size of free blocks */
+#define FREE                (1U)
+
+/* the region ends with an empty block header that is never free */
+#define REGION_BYTES        (GNRC_PKTBUF_SIZE & ~(ALIGNMENT - 1))
+#define HEAD_BITS           (sizeof(unsigned) * 8)
+#define HEADS_NUMOF         ((REGION_BYTES / ALIGNMENT + HEAD_BITS - 1) / HEAD_BITS)
+
+typedef struct {
+    uint32_t prev_size;     /* size of the preceding block, 0 for the first */
+    uint32_t size;          /* size including this header, FREE flag */
+} _hdr_t;
+
+typedef struct _free {
+    _hdr_t hdr;
+    struct _free *next;
+    struct _free *prev;
+} _free_t;
+
+#define MIN_BLOCK           ALIGN(sizeof(_free_t))
+
+typedef struct {
+    memarray_t pool;
+    uint8_t *mem;
+    uint16_t size;
+    uint16_t numof;
+    uint16_t used;
+#ifdef DEVELHELP
+    uint16_t max_used;
+    unsigned overflows;
+#endif
+} _slab_t;
+
+#define SNIP_SIZE           ALIGN(sizeof(gnrc_pktsnip_t))
+
+static uint8_t _snip_mem[GNRC_PKTBUF_SLAB_SNIP_NUMOF * SNIP_SIZE]
+    __attribute__((aligned(ALIGNMENT)));
+static uint8_t _hdr16_mem[GNRC_PKTBUF_SLAB_HDR_NUMOF * 16]
+    __attribute__((aligned(ALIGNMENT)));
+static uint8_t _hdr32_mem[GNRC_PKTBUF_SLAB_HDR_NUMOF * 32]
+    __attribute__((aligned(ALIGNMENT)));
+static uint8_t _hdr48_mem[GNRC_PKTBUF_SLAB_HDR_NUMOF * 48]
+    __attribute__((aligned(ALIGNMENT)));
+
+/* the first slab holds snip descriptors, the others data ordered by size */
+static _slab_t _slabs[] = {
+    { .mem = _snip_mem, .size = SNIP_SIZE, .numof = GNRC_PKTBUF_SLAB_SNIP_NUMOF },
+    { .mem = _hdr16_mem, .size = 16, .numof = GNRC_PKTBUF_SLAB_HDR_NUMOF },
+    { .mem = _hdr32_mem, .size = 32, .numof = GNRC_PKTBUF_SLAB_HDR_NUMOF },
+    { .mem = _hdr48_mem, .size = 48, .numof = GNRC_PKTBUF_SLAB_HDR_NUMOF },
+};
+
+#define SLABS_NUMOF         (sizeof(_slabs) / sizeof(_slabs[0]))
+
+static mutex_t _mutex = MUTEX_INIT;
+static uint8_t _region[REGION_BYTES + sizeof(_hdr_t)]
+    __attribute__((aligned(ALIGNMENT)));
+static unsigned _heads[HEADS_NUMOF];
+static unsigned _fl_map;
+static uint8_t _sl_map[FL_COUNT];
+static _free_t *_lists[FL_COUNT][SL_COUNT];
+
+#ifdef DEVELHELP
+static size_t _region_used;
+static size_t _region_max_used;
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+static void *_pktbuf_alloc_snip(void);
+static void _pktbuf_free(void *data);
+static bool _pktbuf_resize(void *data, size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+    pkt->headroom = 0;
+#endif
+}
+
+/* slabs */
+
+static _slab_t *_slab_of(const void *ptr)
+{
+    for (unsigned i = 0; i < SLABS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        if ((size_t)((const uint8_t *)ptr - slab->mem) <
+            ((size_t)slab->size * slab->numof)) {
+            return slab;
+        }
+    }
+    return NULL;
+}
+
+static inline uint8_t *_slab_elem(const _slab_t *slab, const void *ptr)
+{
+    size_t offset = (const uint8_t *)ptr - slab->mem;
+
+    return slab->mem + (offset - (offset % slab->size));
+}
+
+static void *_slab_alloc(_slab_t *slab)
+{
+    void *ptr = memarray_alloc(&slab->pool);
+
+    if (ptr == NULL) {
+#ifdef DEVELHELP
+        slab->overflows++;
+#endif
+        return NULL;
+    }
+    slab->used++;
+#ifdef DEVELHELP
+    if (slab->used > slab->max_used) {
+        slab->max_used = slab->used;
+    }
+#endif
+    return ptr;
+}
+
+/* TLSF region */
+
+static inline bool _region_contains(const void *ptr)
+{
+    return (size_t)((const uint8_t *)ptr - _region) < REGION_BYTES;
+}
+
+static inline size_t _bsize(const _hdr_t *hdr)
+{
+    return hdr->size & ~FREE;
+}
+
+static inline _hdr_t *_next_phys(const _hdr_t *hdr)
+{
+    return (_hdr_t *)((uint8_t *)hdr + _bsize(hdr));
+}
+
+static inline _hdr_t *_prev_phys(const _hdr_t *hdr)
+{
+    return (_hdr_t *)((uint8_t *)hdr - hdr->prev_size);
+}
+
+static inline void _mark_head(const _hdr_t *hdr, bool head)
+{
+    unsigned idx = ((uint8_t *)hdr - _region) / ALIGNMENT;
+
+    if (head) {
+        _heads[idx / HEAD_BITS] |= 1U << (idx % HEAD_BITS);
+    }
+    else {
+        _heads[idx / HEAD_BITS] &= ~(1U << (idx % HEAD_BITS));
+    }
+}
+
+static _hdr_t *_head_of(const void *ptr)
+{
+    /* the header is in front of the data */
+    unsigned idx = ((const uint8_t *)ptr - _region - sizeof(_hdr_t)) / ALIGNMENT;
+    unsigned word = idx / HEAD_BITS;
+    unsigned bits = _heads[word] & (~0U >> (HEAD_BITS - 1 - (idx % HEAD_BITS)));
+
+    while (bits == 0) {
+        assert(word > 0);
+        bits = _heads[--word];
+    }
+    return (_hdr_t *)(_region + ((word * HEAD_BITS) + bitarithm_msb(bits)) * ALIGNMENT);
+}
+
+static inline void _mapping(size_t size, unsigned *fl, unsigned *sl)
+{
+    unsigned msb = bitarithm_msb(size);
+
+    *sl = (size >> (msb - SL_LOG2)) - SL_COUNT;
+    *fl = msb - FL_SHIFT;
+}
+
+static void _insert(_free_t *block)
+{
+    unsigned fl, sl;
+
+    _mapping(_bsize(&block->hdr), &fl, &sl);
+    block->hdr.size |= FREE;
+    block->prev = NULL;
+    block->next = _lists[fl][sl];
+    if (block->next != NULL) {
+        block->next->prev = block;
+    }
+    _lists[fl][sl] = block;
+    _fl_map |= 1U << fl;
+    _sl_map[fl] |= 1U << sl;
+}
+
+static void _remove(_free_t *block)
+{
+    unsigned fl, sl;
+
+    _mapping(_bsize(&block->hdr), &fl, &sl);
+    block->hdr.size &= ~FREE;
+    if (block->next != NULL) {
+        block->next->prev = block->prev;
+    }
+    if (block->prev != NULL) {
+        block->prev->next = block->next;
+    }
+    else {
+        _lists[fl][sl] = block->next;
+        if (block->next == NULL) {
+            _sl_map[fl] &= ~(1U << sl);
+            if (_sl_map[fl] == 0) {
+                _fl_map &= ~(1U << fl);
+            }
+        }
+    }
+}
+
+static _free_t *_find(size_t size)
+{
+    unsigned fl, sl, map;
+
+    if (size > REGION_BYTES) {
+        return NULL;
+    }
+    _mapping(size, &fl, &sl);
+    /* every block in a higher list is large enough */
+    map = _sl_map[fl] & (~0U << (sl + 1));
+    if (map != 0) {
+        return _lists[fl][bitarithm_lsb(map)];
+    }
+    map = _fl_map & (~0U << (fl + 1));
+    if (map != 0) {
+        unsigned higher = bitarithm_lsb(map);
+        return _lists[higher][bitarithm_lsb(_sl_map[higher])];
+    }
+    /* blocks in the list of size itself may still fit */
+    for (_free_t *block = _lists[fl][sl]; block != NULL; block = block->next) {
+        if (_bsize(&block->hdr) >= size) {
+            return block;
+        }
+    }
+    return NULL;
+}
+
+static void _release(_hdr_t *hdr)
+{
+    _hdr_t *next = _next_phys(hdr);
+
+    if (next->size & FREE) {
+        _remove((_free_t *)next);
+        _mark_head(next, false);
+        hdr->size += next->size;
+    }
+    if (hdr->prev_size != 0) {
+        _hdr_t *prev = _prev_phys(hdr);
+
+        if (prev->size & FREE) {
+            _remove((_free_t *)prev);
+            _mark_head(hdr, false);
+            prev->size += hdr->size;
+            hdr = prev;
+        }
+    }
+    _next_phys(hdr)->prev_size = hdr->size;
+    _insert((_free_t *)hdr);
+}
+
+/* cuts an allocated block down to size and frees the rest */
+static void _split(_hdr_t *hdr, size_t size)
+{
+    size_t rest = hdr->size - size;
+
+    if (rest < MIN_BLOCK) {
+        return;
+    }
+
+    _hdr_t *tail = (_hdr_t *)((uint8_t *)hdr + size);
+
+    hdr->size = size;
+    tail->size = rest;
+    tail->prev_size = size;
+    _next_phys(tail)->prev_size = rest;
+    _mark_head(tail, true);
+#ifdef DEVELHELP
+    _region_used -= rest;
+#endif
+    _release(tail);
+}
+
+static inline size_t _block_size(size_t size)
+{
+    size = ALIGN(size + sizeof(_hdr_t));
+    return (size < MIN_BLOCK) ? MIN_BLOCK : size;
+}
+
+static void *_region_alloc(size_t size)
+{
+    _free_t *block = _find(_block_size(size));
+
+    if (block == NULL) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+        return NULL;
+    }
+    _remove(block);
+#ifdef DEVELHELP
+    _region_used += block->hdr.size;
+#endif
+    _split(&block->hdr, _block_size(size));
+#ifdef DEVELHELP
+    if (_region_used > _region_max_used) {
+        _region_max_used = _region_used;
+    }
+#endif
+    return (uint8_t *)block + sizeof(_hdr_t);
+}
+
+static void _region_free(void *ptr)
+{
+    _hdr_t *hdr = _head_of(ptr);
+
+    assert(!(hdr->size & FREE));
+#ifdef DEVELHELP
+    _region_used -= hdr->size;
+#endif
+    _release(hdr);
+}
+
+static inline bool _pktbuf_contains(const void *ptr)
+{
+    return _region_contains(ptr) || (_slab_of(ptr) != NULL);
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < SLABS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        memarray_init(&slab->pool, slab->mem, slab->size, slab->numof);
+        slab->used = 0;
+    }
+    memset(_heads, 0, sizeof(_heads));
+    memset(_lists, 0, sizeof(_lists));
+    memset(_sl_map, 0, sizeof(_sl_map));
+    _fl_map = 0;
+
+    _hdr_t *first = (_hdr_t *)_region;
+    _hdr_t *end = (_hdr_t *)&_region[REGION_BYTES];
+
+    first->prev_size = 0;
+    first->size = REGION_BYTES;
+    end->prev_size = REGION_BYTES;
+    end->size = 0;
+    _mark_head(first, true);
+    _insert((_free_t *)first);
+#ifdef DEVELHELP
+    _region_used = 0;
+#endif
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add_headroom(gnrc_pktsnip_t *next, const void *data,
+                                         size_t size, size_t headroom,
+                                         gnrc_nettype_t type)
+{
+    /* headers are allocated separately */
+    (void)headroom;
+    return gnrc_pktbuf_add(next, data, size, type);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc_snip();
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->size == size) {
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    else if (size <= (pkt->size - size)) {
+        /* copy the marked header out, the payload stays where it is */
+        new_data_marked = _pktbuf_alloc(size);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            _pktbuf_free(marked_snip);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        /* copy the smaller remainder out and shrink the marked section */
+        void *new_data_rest = _pktbuf_alloc(pkt->size - size);
+
+        if (new_data_rest == NULL) {
+            DEBUG("pktbuf: could not reallocate remaining section.\n");
+            _pktbuf_free(marked_snip);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
+        new_data_marked = pkt->data;
+        _pktbuf_resize(new_data_marked, size);
+        pkt->data = new_data_rest;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* data does not fit into its current slab element or block */
+    else if ((pkt->data == NULL) || !_pktbuf_resize(pkt->data, size)) {
+        void *new_data = _pktbuf_alloc(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, (pkt->size < size) ? pkt->size : size);
+        }
+        _pktbuf_free(pkt->data);
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_pktbuf_contains(pkt));
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data);
+            _pktbuf_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    unsigned free_blocks = 0;
+    size_t free_bytes = 0, largest = 0;
+
+    mutex_lock(&_mutex);
+    for (_hdr_t *hdr = (_hdr_t *)_region; hdr->size != 0; hdr = _next_phys(hdr)) {
+        if (hdr->size & FREE) {
+            free_blocks++;
+            free_bytes += _bsize(hdr);
+            if (_bsize(hdr) > largest) {
+                largest = _bsize(hdr);
+            }
+        }
+    }
+    printf("packet buffer: slabs and region of %u bytes\n", REGION_BYTES);
+    for (unsigned i = 0; i < SLABS_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        printf("  %s %2u bytes: %3u of %3u used, %3u max, %u overflows\n",
+               (i == 0) ? "snips" : "data ", slab->size, slab->used,
+               slab->numof, slab->max_used, slab->overflows);
+    }
+    printf("  region: %u bytes used, %u max, %u bytes free in %u blocks, "
+           "largest %u\n", (unsigned)_region_used, (unsigned)_region_max_used,
+           (unsigned)free_bytes, free_blocks, (unsigned)largest);
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < SLABS_NUMOF; i++) {
+        if (_slabs[i].used != 0) {
+            return false;
+        }
+    }
+    return ((_hdr_t *)_region)->size == (REGION_BYTES | FREE);
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    size_t prev_size = 0, total = 0;
+    unsigned free_blocks = 0, listed = 0;
+    bool prev_free = false;
+
+    /* Invariants of this implementation:
+     *  - the blocks tile the region and know the size of their predecessor
+     *  - exactly the block headers are marked in _heads
+     *  - no two free blocks are adjacent
+     *  - every free block is in the list of its size and vice versa
+     *  - no slab hands out more elements than it has
+     */
+    for (_hdr_t *hdr = (_hdr_t *)_region; hdr->size != 0; hdr = _next_phys(hdr)) {
+        unsigned idx = ((uint8_t *)hdr - _region) / ALIGNMENT;
+
+        if ((hdr->prev_size != prev_size) || (_bsize(hdr) < MIN_BLOCK) ||
+            !(_heads[idx / HEAD_BITS] & (1U << (idx % HEAD_BITS)))) {
+            return false;
+        }
+        if (hdr->size & FREE) {
+            if (prev_free) {
+                return false;
+            }
+            free_blocks++;
+        }
+        prev_free = hdr->size & FREE;
+        prev_size = _bsize(hdr);
+        total += prev_size;
+        if (total > REGION_BYTES) {
+            return false;
+        }
+    }
+    if (total != REGION_BYTES) {
+        return false;
+    }
+    for (unsigned fl = 0; fl < FL_COUNT; fl++) {
+        for (unsigned sl = 0; sl < SL_COUNT; sl++) {
+            for (_free_t *block = _lists[fl][sl]; block; block = block->next) {
+                unsigned bfl, bsl;
+
+                _mapping(_bsize(&block->hdr), &bfl, &bsl);
+                if (!(block->hdr.size & FREE) || (bfl != fl) || (bsl != sl)) {
+                    return false;
+                }
+                listed++;
+            }
+        }
+    }
+    for (unsigned i = 0; i < SLABS_NUMOF; i++) {
+        if (_slabs[i].used > _slabs[i].numof) {
+            return false;
+        }
+    }
+    return listed == free_blocks;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc_snip();
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    for (unsigned i = 1; i < SLABS_NUMOF; i++) {
+        if (size <= _slabs[i].size) {
+            void *ptr = _slab_alloc(&_slabs[i]);
+            if (ptr != NULL) {
+                return ptr;
+            }
+            break;
+        }
+    }
+    return _region_alloc(size);
+}
+
+static void *_pktbuf_alloc_snip(void)
+{
+    void *ptr = _slab_alloc(&_slabs[0]);
+
+    return (ptr != NULL) ? ptr : _region_alloc(sizeof(gnrc_pktsnip_t));
+}
+
+static void _pktbuf_free(void *data)
+{
+    _slab_t *slab;
+
+    if (data == NULL) {
+        return;
+    }
+    if ((slab = _slab_of(data)) != NULL) {
+        memarray_free(&slab->pool, _slab_elem(slab, data));
+        slab->used--;
+    }
+    else if (_region_contains(data)) {
+        _region_free(data);
+    }
+}
+
+/* changes the size of data in place if its slab element or block allows */
+static bool _pktbuf_resize(void *data, size_t size)
+{
+    _slab_t *slab = _slab_of(data);
+
+    if (slab != NULL) {
+        return ((uint8_t *)data - _slab_elem(slab, data)) + size <= slab->size;
+    }
+
+    _hdr_t *hdr = _head_of(data);
+    size_t end = ((uint8_t *)data - (uint8_t *)hdr) + size;
+
+    if (end > hdr->size) {
+        return false;
+    }
+    _split(hdr, (ALIGN(end) < MIN_BLOCK) ? MIN_BLOCK : ALIGN(end));
+    return true;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_duplicate_upto(gnrc_pktsnip_t *pkt, gnrc_nettype_t type)
+{
+    mutex_lock(&_mutex);
+
+    bool is_shared = pkt->users > 1;
+    size_t size = gnrc_pkt_len_upto(pkt, type);
+
+    DEBUG("ipv6_ext: duplicating %d octets\n", (int) size);
+
+    gnrc_pktsnip_t *tmp;
+    gnrc_pktsnip_t *target = gnrc_pktsnip_search_type(pkt, type);
+    gnrc_pktsnip_t *next = (target == NULL) ? NULL : target->next;
+    gnrc_pktsnip_t *new = _create_snip(next, NULL, size, type);
+
+    if (new == NULL) {
+        mutex_unlock(&_mutex);
+
+        return NULL;
+    }
+
+    /* copy payloads */
+    for (tmp = pkt; tmp != NULL; tmp = tmp->next) {
+        uint8_t *dest = ((uint8_t *)new->data) + (size - tmp->size);
+
+        memcpy(dest, tmp->data, tmp->size);
+
+        size -= tmp->size;
+
+        if (tmp->type == type) {
+            break;
+        }
+    }
+
+    /* decrements reference counters */
+
+    if (target != NULL) {
+        target->next = NULL;
+    }
+
+    _release_error_locked(pkt, GNRC_NETERR_SUCCESS);
+
+    if (is_shared && (target != NULL)) {
+        target->next = next;
+    }
+
+    mutex_unlock(&_mutex);
+
+    return new;
+}
+
+/** @} */
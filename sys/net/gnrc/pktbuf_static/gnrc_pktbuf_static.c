@@ -77,7 +77,46 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+    pkt->headroom = 0;
+#endif
+}
+
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+/* bytes a snip and its data take from the headroom */
+static inline size_t _headroom_needed(size_t size)
+{
+    return _align(sizeof(gnrc_pktsnip_t)) + _align(size);
+}
+
+/* Places a new snip in the headroom of next, in front of next's snip:
+ *
+ *      | headroom left | new snip | new data | next snip | next data |
+ *
+ * next is only accessible by the caller when it has a single user, so the
+ * headroom can be taken without locking */
+static gnrc_pktsnip_t *_push(gnrc_pktsnip_t *next, const void *data,
+                             size_t size, gnrc_nettype_t type)
+{
+    size_t needed = _headroom_needed(size);
+    gnrc_pktsnip_t *pkt;
+    uint8_t *_data;
+
+    if ((next == NULL) || (size == 0) || (next->users != 1) ||
+        (next->headroom < needed)) {
+        return NULL;
+    }
+    _data = (uint8_t *)next - _align(size);
+    pkt = (gnrc_pktsnip_t *)(_data - _align(sizeof(gnrc_pktsnip_t)));
+    if (data != NULL) {
+        memcpy(_data, data, size);
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    pkt->headroom = next->headroom - needed;
+    next->headroom = 0;
+    return pkt;
 }
+#endif
 
 void gnrc_pktbuf_init(void)
 {
@@ -98,12 +137,55 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
               (unsigned)size, GNRC_PKTBUF_SIZE);
         return NULL;
     }
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+    if ((pkt = _push(next, data, size, type)) != NULL) {
+        return pkt;
+    }
+#endif
     mutex_lock(&_mutex);
     pkt = _create_snip(next, data, size, type);
     mutex_unlock(&_mutex);
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_add_headroom(gnrc_pktsnip_t *next, const void *data,
+                                         size_t size, size_t headroom,
+                                         gnrc_nettype_t type)
+{
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+    gnrc_pktsnip_t *pkt;
+    uint8_t *chunk, *_data;
+
+    headroom = _align(headroom);
+    if ((headroom > UINT16_MAX) ||
+        ((headroom + _headroom_needed(size)) > GNRC_PKTBUF_SIZE)) {
+        DEBUG("pktbuf: size (%u) + headroom (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, (unsigned)headroom, GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    /* snip and data in one chunk behind the headroom, so the snip can
+     * release the headroom with itself */
+    mutex_lock(&_mutex);
+    chunk = _pktbuf_alloc(headroom + _headroom_needed(size));
+    mutex_unlock(&_mutex);
+    if (chunk == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip with headroom\n");
+        return NULL;
+    }
+    pkt = (gnrc_pktsnip_t *)(chunk + headroom);
+    _data = (uint8_t *)pkt + _align(sizeof(gnrc_pktsnip_t));
+    if ((size > 0) && (data != NULL)) {
+        memcpy(_data, data, size);
+    }
+    _set_pktsnip(pkt, next, (size > 0) ? _data : NULL, size, type);
+    pkt->headroom = headroom;
+    return pkt;
+#else
+    (void)headroom;
+    return gnrc_pktbuf_add(next, data, size, type);
+#endif
+}
+
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
@@ -228,7 +310,12 @@ static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
         if (pkt->users == 1) {
             pkt->users = 0; /* not necessary but to be on the safe side */
             _pktbuf_free(pkt->data, pkt->size);
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+            _pktbuf_free((uint8_t *)pkt - pkt->headroom,
+                         pkt->headroom + sizeof(gnrc_pktsnip_t));
+#else
             _pktbuf_free(pkt, sizeof(gnrc_pktsnip_t));
+#endif
         }
         else {
             pkt->users--;
@@ -22,12 +22,23 @@
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
 #include "net/udp.h"
 
 #include "gnrc_sock_internal.h"
 
+/**
+ * @brief   Headroom for the UDP, IPv6 and interface header prepended to a
+ *          datagram
+ */
+#define _SEND_HEADROOM  GNRC_PKTBUF_HEADROOM(3, sizeof(udp_hdr_t) + \
+                                                sizeof(ipv6_hdr_t) + \
+                                                sizeof(gnrc_netif_hdr_t) + \
+                                                GNRC_NETIF_L2ADDR_MAXLEN)
+
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
 static sock_udp_t *_udp_socks = NULL;
 #endif
@@ -304,7 +315,8 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
         return -EINVAL;
     }
     /* generate payload and header snips */
-    payload = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
+    payload = gnrc_pktbuf_add_headroom(NULL, (void *)data, len, _SEND_HEADROOM,
+                                       GNRC_NETTYPE_UNDEF);
     if (payload == NULL) {
         return -ENOMEM;
     }
@@ -279,6 +279,7 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     tcb->rtt_var = RTO_UNINITIALIZED;
     tcb->srtt = RTO_UNINITIALIZED;
     tcb->rto = RTO_UNINITIALIZED;
+    tcb->cc = GNRC_TCP_CC_DEFAULT;
     mbox_init(&(tcb->mbox), tcb->mbox_raw, GNRC_TCP_TCB_MBOX_SIZE);
     mutex_init(&(tcb->fsm_lock));
     mutex_init(&(tcb->function_lock));
@@ -375,8 +376,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         _setup_timeout(&user_timeout, timeout_duration_us, _cb_mbox_put_msg, &user_timeout_arg);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent. Acknowledgments are processed in the background. */
+    while (ret == 0) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             ret = -ECONNRESET;
@@ -395,9 +396,13 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                            &probe_timeout_arg);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
+        /* Try to send data in case we are not probing. Wait if the window or */
+        /* the retransmit queue is full. */
+        if (!probing_mode) {
             ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+            if (ret != 0) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -411,7 +416,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+                /* Nothing of this call was queued yet. Queued segments were */
+                /* reported as sent already and stay in the retransmit queue. */
                 ret = -ETIMEDOUT;
                 break;
 
@@ -527,8 +533,8 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                     break;
 
                 case MSG_TYPE_USER_SPEC_TIMEOUT:
-                    DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                    _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+                    DEBUG("gnrc_tcp.c : gnrc_tcp_recv() : USER_SPEC_TIMEOUT\n");
+                    /* Data sent before stays in the retransmit queue */
                     ret = -ETIMEDOUT;
                     break;
 
@@ -557,6 +563,7 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     msg_t msg;
     xtimer_t connection_timeout;
     cb_arg_t connection_timeout_arg = {MSG_TYPE_CONNECTION_TIMEOUT, &(tcb->mbox)};
+    bool closing = false;
 
     /* Lock the TCB for this function call */
     mutex_lock(&(tcb->function_lock));
@@ -578,11 +585,15 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     _setup_timeout(&connection_timeout, GNRC_TCP_CONNECTION_TIMEOUT_DURATION,
                    _cb_mbox_put_msg, &connection_timeout_arg);
 
-    /* Start connection teardown sequence */
-    _fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
-
     /* Loop until the connection has been closed */
     while (tcb->state != FSM_STATE_CLOSED) {
+        /* Start connection teardown sequence as soon as the FIN fits into the retransmit queue */
+        if (!closing && tcb->rtx_len < GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+            _fsm(tcb, FSM_EVENT_CALL_CLOSE, NULL, NULL, 0);
+            closing = true;
+            continue;
+        }
+
         mbox_get(&(tcb->mbox), &msg);
         switch (msg.type) {
             case MSG_TYPE_CONNECTION_TIMEOUT:
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       NewReno congestion control (RFC 5681, RFC 6582)
+ * @}
+ */
+
+#include "net/gnrc/tcp/cc.h"
+#include "internal/common.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief Upper bound for the congestion window: The largest window a peer can advertise.
+ */
+#define CWND_MAX (UINT16_MAX)
+
+/**
+ * @brief Calculates the sender maximum segment size (SMSS).
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Size of the largest segment sent on the connection.
+ */
+static inline uint32_t _smss(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->mss > 0 && tcb->mss < GNRC_TCP_MSS) ? tcb->mss : GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Calculates the amount of sent but unacknowledged data.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Flight size in bytes.
+ */
+static inline uint32_t _flight_size(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_nxt - tcb->snd_una;
+}
+
+/**
+ * @brief Increases the congestion window, limited by CWND_MAX.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     inc   Number of bytes to add.
+ */
+static inline void _inc_cwnd(gnrc_tcp_tcb_t *tcb, uint32_t inc)
+{
+    tcb->cwnd = (tcb->cwnd + inc < CWND_MAX) ? tcb->cwnd + inc : CWND_MAX;
+}
+
+/**
+ * @brief Halves the flight size into the slow start threshold (RFC 5681, equation 4).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _reduce_ssthresh(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t half = _flight_size(tcb) / 2;
+    uint32_t min = 2 * _smss(tcb);
+
+    tcb->ssthresh = (half > min) ? half : min;
+}
+
+static void _newreno_init(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _smss(tcb);
+
+    /* Initial window (RFC 5681, section 3.1) */
+    if (smss > 2190) {
+        tcb->cwnd = 2 * smss;
+    }
+    else if (smss > 1095) {
+        tcb->cwnd = 3 * smss;
+    }
+    else {
+        tcb->cwnd = 4 * smss;
+    }
+    tcb->ssthresh = CWND_MAX;
+    tcb->recover = tcb->iss;
+    tcb->dup_acks = 0;
+}
+
+static bool _newreno_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t smss = _smss(tcb);
+
+    /* Fast recovery (RFC 6582, section 3.2, step 3) */
+    if (tcb->dup_acks >= GNRC_TCP_CC_DUP_ACK_THRESHOLD) {
+        /* Full acknowledgment: Deflate the window and leave fast recovery */
+        if (LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+            uint32_t flight = _flight_size(tcb);
+            uint32_t cwnd = ((flight > smss) ? flight : smss) + smss;
+
+            DEBUG("gnrc_tcp_cc.c : _newreno_ack() : Leave fast recovery\n");
+            tcb->cwnd = (tcb->ssthresh < cwnd) ? tcb->ssthresh : cwnd;
+            tcb->dup_acks = 0;
+            return false;
+        }
+        /* Partial acknowledgment: Deflate the window by the acknowledged data */
+        /* and retransmit the next unacknowledged segment */
+        tcb->cwnd = (tcb->cwnd > acked) ? tcb->cwnd - acked : 0;
+        if (acked >= smss) {
+            _inc_cwnd(tcb, smss);
+        }
+        return true;
+    }
+
+    tcb->dup_acks = 0;
+    /* Slow start (RFC 5681, equation 2) */
+    if (tcb->cwnd < tcb->ssthresh) {
+        _inc_cwnd(tcb, (acked < smss) ? acked : smss);
+    }
+    /* Congestion avoidance (RFC 5681, equation 3) */
+    else {
+        uint32_t inc = (smss * smss) / tcb->cwnd;
+
+        _inc_cwnd(tcb, (inc > 0) ? inc : 1);
+    }
+    /* Segments sent before a retransmission timeout are still outstanding: */
+    /* Retransmit the next one instead of waiting for another timeout */
+    return LSS_32_BIT(tcb->snd_una, tcb->recover);
+}
+
+static bool _newreno_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _smss(tcb);
+
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks += 1;
+    }
+    if (tcb->dup_acks < GNRC_TCP_CC_DUP_ACK_THRESHOLD) {
+        return false;
+    }
+    /* Inflate the window for each segment that left the network (RFC 5681, section 3.2) */
+    if (tcb->dup_acks > GNRC_TCP_CC_DUP_ACK_THRESHOLD) {
+        _inc_cwnd(tcb, smss);
+        return false;
+    }
+    /* Duplicate ACKs for data sent before the last recovery: Don't recover */
+    /* again (RFC 6582, section 3.2, step 2) */
+    if (!LSS_32_BIT(tcb->recover, tcb->snd_una)) {
+        tcb->dup_acks = 0;
+        return false;
+    }
+    /* Fast retransmit and enter fast recovery (RFC 6582, section 3.2, step 2) */
+    DEBUG("gnrc_tcp_cc.c : _newreno_dup_ack() : Enter fast recovery\n");
+    _reduce_ssthresh(tcb);
+    tcb->recover = tcb->snd_nxt;
+    tcb->cwnd = tcb->ssthresh + GNRC_TCP_CC_DUP_ACK_THRESHOLD * smss;
+    return true;
+}
+
+static void _newreno_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    /* Reduce ssthresh only once if a segment is retransmitted repeatedly */
+    if (tcb->retries == 0) {
+        _reduce_ssthresh(tcb);
+    }
+    /* Restart with the loss window (RFC 5681, section 3.1) */
+    tcb->cwnd = _smss(tcb);
+    tcb->recover = tcb->snd_nxt;
+    tcb->dup_acks = 0;
+}
+
+const gnrc_tcp_cc_t gnrc_tcp_cc_newreno = {
+    .init = _newreno_init,
+    .ack = _newreno_ack,
+    .dup_ack = _newreno_dup_ack,
+    .timeout = _newreno_timeout,
+};
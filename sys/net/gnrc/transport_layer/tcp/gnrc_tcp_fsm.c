@@ -22,6 +22,7 @@
 #include "random.h"
 #include "net/af.h"
 #include "net/gnrc.h"
+#include "net/gnrc/tcp/cc.h"
 #include "internal/common.h"
 #include "internal/pkt.h"
 #include "internal/option.h"
@@ -83,10 +84,26 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        xtimer_remove(&(tcb->tim_tout));
-        tcb->pkt_retransmit = NULL;
+    _pkt_clear_retransmit(tcb);
+    return 0;
+}
+
+/**
+ * @brief Retransmits the first unacknowledged segment without waiting for the
+ *        retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ *
+ * @return   Zero on success.
+ */
+static int _fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_pktsnip_t *pkt = _pkt_get_retransmit(tcb);
+
+    if (pkt != NULL) {
+        /* Every send attempt consumes a user */
+        gnrc_pktbuf_hold(pkt, 1);
+        _pkt_send(tcb, pkt, 0, true);
     }
     return 0;
 }
@@ -191,8 +208,13 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             mutex_unlock(&_list_tcb_lock);
             break;
 
-        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_ESTABLISHED:
+            /* Initialize congestion control, the peers MSS is known by now */
+            tcb->cc->init(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
+        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -223,6 +245,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_open()\n");
     tcb->rcv_wnd = GNRC_TCP_DEFAULT_WINDOW;
+    tcb->rcv_held = 0;
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -267,24 +290,39 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    /* Send segments while the window is open and the retransmit queue has space */
+    while (sent < len && tcb->snd_wnd > 0 && tcb->rtx_len < GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        /* Send no more than the peers receive window and the congestion window allow */
+        uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+        size_t payload = (flight < wnd) ? wnd - flight : 0;
+        size_t full = len - sent;
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < GNRC_TCP_MSS) ? payload : GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        full = (full < GNRC_TCP_MSS) ? full : GNRC_TCP_MSS;
+        full = (full < tcb->mss) ? full : tcb->mss;
+        payload = (payload < full) ? payload : full;
 
-        /* Calculate payload size for this segment */
+        /* Avoid silly window syndrome: While data is in flight, */
+        /* wait until a full segment can be sent (RFC 1122, section 4.2.3.4) */
+        if (payload == 0 || (payload < full && flight > 0)) {
+            break;
+        }
+
+        /* Build, queue and send segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt,
+                       (uint8_t *) buf + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
     }
-    return 0;
+    return sent;
 }
 
 /**
@@ -383,6 +421,56 @@ static int _fsm_call_abort(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief Hold payload that arrived ahead of rcv_nxt in the free space of the receive buffer.
+ *
+ * Only one range is held. A segment that does not continue it is dropped, as before.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seg_seq   Sequence number of the segment.
+ * @param[in]     snp       First payload snip of the segment.
+ */
+static void _rcv_hold(gnrc_tcp_tcb_t *tcb, uint32_t seg_seq, gnrc_pktsnip_t *snp)
+{
+    if (tcb->rcv_held == 0) {
+        tcb->rcv_held_seq = seg_seq;
+    }
+    else if (seg_seq != tcb->rcv_held_seq + tcb->rcv_held) {
+        return;
+    }
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        unsigned held = spsc_ring_write_ahead(&(tcb->rcv_buf), seg_seq - tcb->rcv_nxt,
+                                              snp->data, snp->size);
+
+        tcb->rcv_held += held;
+        seg_seq += held;
+        if (held < snp->size) {
+            break;
+        }
+        snp = snp->next;
+    }
+}
+
+/**
+ * @brief Take held payload over into the receive buffer, once rcv_nxt reached it.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _rcv_take_held(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rcv_held == 0 || LSS_32_BIT(tcb->rcv_nxt, tcb->rcv_held_seq)) {
+        return;
+    }
+    uint32_t held_end = tcb->rcv_held_seq + tcb->rcv_held;
+
+    /* The data before rcv_nxt was written again in order, commit only the rest */
+    if (LSS_32_BIT(tcb->rcv_nxt, held_end)) {
+        spsc_ring_commit(&(tcb->rcv_buf), held_end - tcb->rcv_nxt);
+        tcb->rcv_nxt = held_end;
+    }
+    tcb->rcv_held = 0;
+}
+
 /**
  * @brief FSM handling function for processing of an incomming TCP packet.
  *
@@ -632,8 +720,27 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
                     _pkt_acknowledge(tcb, seg_ack);
+                    /* Partial ACK below recover: The next segment was lost as well */
+                    if (tcb->cc->ack(tcb, acked)) {
+                        tcb->stats.recovery_retransmits += 1;
+                        _fast_retransmit(tcb);
+                    }
+                    /* Signal user: Acknowledged data freed space in the retransmit queue */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK (see RFC 5681, section 2): Pass to congestion control */
+                else if (seg_ack == tcb->snd_una && tcb->snd_una != tcb->snd_nxt &&
+                         pay_len == 0 && !(ctl & (MSK_SYN | MSK_FIN)) &&
+                         seg_wnd == tcb->snd_wnd) {
+                    tcb->stats.dup_acks += 1;
+                    if (tcb->cc->dup_ack(tcb)) {
+                        tcb->stats.fast_retransmits += 1;
+                        _fast_retransmit(tcb);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -657,25 +764,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionaly if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -700,11 +807,16 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+                    _rcv_take_held(tcb);
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Hold data ahead of a gap, the ACK below is a duplicate ACK for the sender */
+                else if (LSS_32_BIT(tcb->rcv_nxt, seg_seq)) {
+                    _rcv_hold(tcb, seg_seq, snp);
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
                 if (!(ctl & MSK_FIN)) {
@@ -720,6 +832,12 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_SYN_SENT) {
                 return 0;
             }
+            /* FIN arrived ahead of missing data: Acknowledge received data, wait for the rest */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
+                _pkt_send(tcb, out_pkt, seq_con, false);
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
@@ -729,7 +847,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -771,9 +889,13 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    gnrc_pktsnip_t *pkt = _pkt_get_retransmit(tcb);
+
+    if (pkt != NULL) {
+        tcb->stats.retransmits += 1;
+        tcb->cc->timeout(tcb);
+        _pkt_setup_retransmit(tcb, pkt, true);
+        _pkt_send(tcb, pkt, 0, true);
     }
     else {
         DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
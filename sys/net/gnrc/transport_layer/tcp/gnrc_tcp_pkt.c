@@ -260,14 +260,16 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number. Retransmissions */
+    /* always resend the oldest segment, its rtt can't be measured anymore. */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
     }
     else {
         tcb->retries += 1;
+        if (tcb->rtx_len > 0) {
+            tcb->rtx[tcb->rtx_head].retransmitted = true;
+        }
     }
 
     /* Pass packet down the network stack */
@@ -339,41 +341,17 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
-int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
+/**
+ * @brief Adjusts the RTO and (re)starts the retransmission timer for the oldest segment.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     backoff   Flag used to indicate that the RTO should be backed off.
+ */
+static void _setup_retransmit_timer(gnrc_tcp_tcb_t *tcb, const bool backoff)
 {
-    gnrc_pktsnip_t *snp = NULL;
-    uint32_t ctl = 0;
-    uint32_t len = 0;
-
-    /* No packet received */
-    if (pkt == NULL) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : pkt=NULL\n");
-        return -EINVAL;
-    }
-
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
-        return -ENOMEM;
-    }
-
-    /* Extract control bits and segment length */
-    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
-    ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
-    len = _pkt_get_pay_len(pkt);
-
-    /* Check if pkt contains reset or is a pure ACK, return */
-    if ((ctl & MSK_RST) || (((ctl & MSK_SYN_FIN_ACK) == MSK_ACK) && len == 0)) {
-        return 0;
-    }
-
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
     /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+    if (!backoff) {
+        /* If there is no rtt measurement yet: rto is 1 sec (Lower Bound) */
         if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
             tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
         }
@@ -405,38 +383,119 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
     tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
     tcb->msg_tout.content.ptr = (void *) tcb;
     xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
+int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
+{
+    gnrc_pktsnip_t *snp = NULL;
+    gnrc_tcp_rtx_t *entry = NULL;
+    uint32_t ctl = 0;
+    uint32_t len = 0;
+
+    /* No packet received */
+    if (pkt == NULL) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : pkt=NULL\n");
+        return -EINVAL;
+    }
+
+    /* Extract control bits and segment length */
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+    ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
+    len = _pkt_get_pay_len(pkt);
+
+    /* Check if pkt contains reset or is a pure ACK, return */
+    if ((ctl & MSK_RST) || (((ctl & MSK_SYN_FIN_ACK) == MSK_ACK) && len == 0)) {
+        return 0;
+    }
+
+    if (!retransmit) {
+        /* Check if retransmit queue is full */
+        if (tcb->rtx_len >= GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Retransmit queue is full\n");
+            return -ENOMEM;
+        }
+
+        /* Append pkt to the retransmit queue */
+        entry = &tcb->rtx[(tcb->rtx_head + tcb->rtx_len) % GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+        entry->pkt = pkt;
+        entry->seq_end = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num) +
+                         _pkt_get_seg_len(pkt);
+        entry->sent = xtimer_now().ticks32;
+        entry->retransmitted = false;
+        tcb->rtx_len += 1;
+    }
+    /* Only the oldest segment is retransmitted */
+    else if (tcb->rtx_len == 0 || tcb->rtx[tcb->rtx_head].pkt != pkt) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : pkt is not the oldest segment\n");
+        return -EINVAL;
+    }
+
+    /* Increase users: every send attempt consumes a user */
+    gnrc_pktbuf_hold(pkt, 1);
+
+    /* The timer runs for the oldest segment. It is already running if */
+    /* this segment was appended behind others. */
+    if (retransmit || tcb->rtx_len == 1) {
+        _setup_retransmit_timer(tcb, retransmit);
+    }
     return 0;
 }
 
+gnrc_pktsnip_t *_pkt_get_retransmit(const gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rtx_len == 0) {
+        return NULL;
+    }
+    return tcb->rtx[tcb->rtx_head].pkt;
+}
+
+void _pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    xtimer_remove(&(tcb->tim_tout));
+    while (tcb->rtx_len > 0) {
+        gnrc_pktbuf_release(tcb->rtx[tcb->rtx_head].pkt);
+        tcb->rtx[tcb->rtx_head].pkt = NULL;
+        tcb->rtx_head = (tcb->rtx_head + 1) % GNRC_TCP_RETRANSMIT_QUEUE_SIZE;
+        tcb->rtx_len -= 1;
+    }
+}
+
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    gnrc_tcp_rtx_t *entry = NULL;
+    int32_t rtt = 0;
+    bool acked = false;
+    bool sample = true;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release every segment covered by the cumulative acknowledgment */
+    while (tcb->rtx_len > 0 && LEQ_32_BIT(tcb->rtx[tcb->rtx_head].seq_end, ack)) {
+        entry = &tcb->rtx[tcb->rtx_head];
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
+        /* Measure round trip time of the newest acknowledged segment. Skip the */
+        /* sample if any acknowledged segment was retransmitted (Karns Algorithm). */
+        rtt = xtimer_now().ticks32 - entry->sent;
+        sample = sample && !entry->retransmitted;
 
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->tim_tout));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        gnrc_pktbuf_release(entry->pkt);
+        entry->pkt = NULL;
+        tcb->rtx_head = (tcb->rtx_head + 1) % GNRC_TCP_RETRANSMIT_QUEUE_SIZE;
+        tcb->rtx_len -= 1;
+        acked = true;
+    }
 
-        /* Measure round trip time */
-        int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
+    /* If segments were acknowledged -> stop timer and update rto. */
+    if (acked) {
+        xtimer_remove(&(tcb->tim_tout));
+        tcb->retries = 0;
 
-        /* Use time only if ther was no timer overflow and no retransmission (Karns Alogrithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        /* Use time only if there was no timer overflow and no retransmission */
+        if (sample && rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -450,6 +509,11 @@ int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
                 tcb->srtt += rtt / GNRC_TCP_RTO_A_DIV;
             }
         }
+
+        /* Restart the timer for the remaining segments (RFC 6298, section 5.3) */
+        if (tcb->rtx_len > 0) {
+            _setup_retransmit_timer(tcb, false);
+        }
     }
     return 0;
 }
@@ -110,18 +110,38 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * New packets are appended to the retransmission queue. A retransmit must be
+ * the oldest packet in the queue, it backs off the retransmission timer.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or a retransmit is not the oldest packet.
  */
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Gets the oldest unacknowledged segment of the retransmission mechanism.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Oldest segment in the retransmission queue.
+ *            NULL if the retransmission queue is empty.
+ */
+gnrc_pktsnip_t *_pkt_get_retransmit(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Removes all packets from the retransmission mechanism and stops its timer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
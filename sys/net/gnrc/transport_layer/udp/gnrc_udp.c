@@ -220,13 +220,34 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_RTC
+static void _rtc_handler(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    (void)ctx;
+    /* receiving needs no state of the UDP thread */
+    if ((cmd == GNRC_NETAPI_MSG_TYPE_RCV) && (sched_active_pid != _pid)) {
+        _receive(pkt);
+    }
+    else {
+        gnrc_netapi_rtc_defer(_pid, cmd, pkt);
+    }
+}
+
+static gnrc_netreg_entry_cbd_t _rtc_cbd = { .cb = _rtc_handler };
+#endif
+
 static void *_event_loop(void *arg)
 {
     (void)arg;
     msg_t msg, reply;
     msg_t msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_RTC
+    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_CB(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                           &_rtc_cbd);
+#else
     gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
+#endif
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
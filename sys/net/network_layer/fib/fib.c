@@ -37,6 +37,9 @@
 
 #include "net/fib.h"
 #include "net/fib/table.h"
+#ifdef MODULE_FIB_RADIX
+#include "net/fib/radix.h"
+#endif
 
 #ifdef MODULE_IPV6_ADDR
 #include "net/ipv6/addr.h"
@@ -66,6 +69,253 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+static int fib_sr_check_lifetime(fib_table_t *table, fib_sr_t *fib_sr);
+
+#ifdef MODULE_FIB_RADIX
+/**
+ * @brief key namespace of the hops of source routes,
+ *        destinations are stored in namespace 0
+ */
+#define FIB_RADIX_NS_HOP    (0x80)
+
+/**
+ * @brief builds the radix key for the first bits of an address
+ *
+ * @param[out] key      the key, of FIB_RADIX_KEY_SIZE bytes
+ * @param[in] ns        the key namespace
+ * @param[in] addr      the address
+ * @param[in] addr_size the address size
+ * @param[in] bits      the number of leading bits of addr to use
+ *
+ * @return the length of the key in bits
+ */
+static unsigned _fib_key(uint8_t *key, uint8_t ns, const uint8_t *addr,
+                         size_t addr_size, unsigned bits)
+{
+    key[0] = ns | (uint8_t)addr_size;
+    memcpy(&key[1], addr, addr_size);
+    return 8 + bits;
+}
+
+/**
+ * @brief adds an item to or removes it from the radix index of the table
+ */
+static void _fib_index(fib_table_t *table, uint8_t ns,
+                       universal_address_container_t *addr, unsigned bits,
+                       void *item, bool add)
+{
+    uint8_t key[FIB_RADIX_KEY_SIZE];
+    unsigned key_len;
+
+    if (!fib_radix_usable(&table->radix) || (addr == NULL)) {
+        return;
+    }
+    key_len = _fib_key(key, ns, addr->address, addr->address_size, bits);
+    if (add) {
+        fib_radix_insert(&table->radix, key, key_len, item);
+    }
+    else {
+        fib_radix_remove(&table->radix, key, key_len, item);
+    }
+}
+
+/**
+ * @brief indexes a single hop entry by the leading bits of its destination
+ *        it matches, i.e. none for the default route, the prefix for entries
+ *        flagged with a prefix length and all bits otherwise
+ */
+static void _fib_entry_index(fib_table_t *table, fib_entry_t *entry, bool add)
+{
+    universal_address_container_t *global = entry->global;
+    unsigned bits;
+
+    if (global == NULL) {
+        return;
+    }
+    bits = global->address_size << 3;
+    for (size_t i = 0; i < global->address_size; i++) {
+        if (global->address[i] != 0) {
+            if (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK) {
+                unsigned prefix = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                                  >> FIB_FLAG_NET_PREFIX_SHIFT;
+
+                bits = (prefix < bits) ? prefix : bits;
+            }
+            _fib_index(table, 0, global, bits, entry, add);
+            return;
+        }
+    }
+    /* the default route matches any address of its size */
+    _fib_index(table, 0, global, 0, entry, add);
+}
+
+/**
+ * @brief indexes the destination of a source route
+ */
+static void _fib_sr_dest_index(fib_table_t *table, fib_sr_t *fib_sr, bool add)
+{
+    if (fib_sr->sr_dest != NULL) {
+        universal_address_container_t *dest = fib_sr->sr_dest->address;
+
+        if (dest != NULL) {
+            _fib_index(table, 0, dest, dest->address_size << 3, fib_sr, add);
+        }
+    }
+}
+
+/**
+ * @brief indexes a hop of a source route
+ */
+static void _fib_sr_hop_index(fib_table_t *table, fib_sr_entry_t *hop, bool add)
+{
+    if (hop->address != NULL) {
+        _fib_index(table, FIB_RADIX_NS_HOP, hop->address,
+                   hop->address->address_size << 3, hop, add);
+    }
+}
+
+/**
+ * @brief indexes the destination and all hops of a source route
+ */
+static void _fib_sr_index(fib_table_t *table, fib_sr_t *fib_sr, bool add)
+{
+    fib_sr_entry_t *elt = NULL;
+
+    _fib_sr_dest_index(table, fib_sr, add);
+    LL_FOREACH(fib_sr->sr_path, elt) {
+        _fib_sr_hop_index(table, elt, add);
+    }
+}
+
+/**
+ * @brief keeps track of the earliest lifetime of the entries of the table
+ */
+static void _fib_expiry(fib_table_t *table, uint64_t lifetime)
+{
+    if (lifetime < table->next_expiry) {
+        table->next_expiry = lifetime;
+    }
+}
+
+/**
+ * @brief removes the expired entries of the table,
+ *        the table is only searched once the earliest lifetime passed
+ */
+static void _fib_expire(fib_table_t *table)
+{
+    uint64_t now;
+
+    if (table->next_expiry == FIB_LIFETIME_NO_EXPIRE) {
+        return;
+    }
+    now = xtimer_now_usec64();
+    if (table->next_expiry >= now) {
+        return;
+    }
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    for (size_t i = 0; i < table->size; ++i) {
+        if (table->table_type == FIB_TABLE_TYPE_SR) {
+            fib_sr_t *fib_sr = &table->data.source_routes->headers[i];
+
+            if ((fib_sr->sr_lifetime != 0) &&
+                (fib_sr_check_lifetime(table, fib_sr) == 0)) {
+                _fib_expiry(table, fib_sr->sr_lifetime);
+            }
+        }
+        else if (table->data.entries[i].lifetime != 0) {
+            fib_entry_t *entry = &table->data.entries[i];
+
+            if (entry->lifetime < now) {
+                fib_remove(table, entry);
+            }
+            else {
+                _fib_expiry(table, entry->lifetime);
+            }
+        }
+    }
+}
+
+/**
+ * @brief returns pointer to the entry for the given destination address
+ *        using the radix index, see fib_find_entry()
+ */
+static int _fib_radix_find_entry(fib_table_t *table, uint8_t *dst,
+                                 size_t dst_size, fib_entry_t **entry_arr,
+                                 size_t *entry_arr_size)
+{
+    uint8_t key[FIB_RADIX_KEY_SIZE];
+    unsigned key_len;
+    fib_radix_node_t *node = NULL, *match = NULL;
+
+    _fib_expire(table);
+    *entry_arr_size = 0;
+    if (dst_size > UNIVERSAL_ADDRESS_SIZE) {
+        return -EHOSTUNREACH;
+    }
+    key_len = _fib_key(key, 0, dst, dst_size, dst_size << 3);
+    while ((node = fib_radix_match(&table->radix, node, key, key_len)) != NULL) {
+        for (fib_radix_node_t *dup = node; dup != NULL; dup = dup->dup) {
+            fib_entry_t *entry = dup->item;
+
+            table->stats.compared++;
+            /* an entry for exactly this address beats any prefix */
+            if (memcmp(entry->global->address, dst, dst_size) == 0) {
+                entry_arr[0] = entry;
+                *entry_arr_size = 1;
+                return 1;
+            }
+        }
+        match = node;
+    }
+    if (match == NULL) {
+        return -EHOSTUNREACH;
+    }
+    DEBUG("[fib_find_entry] found prefix of %u bits\n",
+          (unsigned)(match->key_len - 8));
+    entry_arr[0] = match->item;
+    *entry_arr_size = 1;
+    return 0;
+}
+#else
+static inline void _fib_entry_index(fib_table_t *table, fib_entry_t *entry,
+                                    bool add)
+{
+    (void)table;
+    (void)entry;
+    (void)add;
+}
+
+static inline void _fib_sr_dest_index(fib_table_t *table, fib_sr_t *fib_sr,
+                                      bool add)
+{
+    (void)table;
+    (void)fib_sr;
+    (void)add;
+}
+
+static inline void _fib_sr_hop_index(fib_table_t *table, fib_sr_entry_t *hop,
+                                     bool add)
+{
+    (void)table;
+    (void)hop;
+    (void)add;
+}
+
+static inline void _fib_sr_index(fib_table_t *table, fib_sr_t *fib_sr, bool add)
+{
+    (void)table;
+    (void)fib_sr;
+    (void)add;
+}
+
+static inline void _fib_expiry(fib_table_t *table, uint64_t lifetime)
+{
+    (void)table;
+    (void)lifetime;
+}
+#endif /* MODULE_FIB_RADIX */
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -82,6 +332,13 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
+#ifdef MODULE_FIB_RADIX
+    if (fib_radix_usable(&table->radix)) {
+        return _fib_radix_find_entry(table, dst, dst_size, entry_arr,
+                                     entry_arr_size);
+    }
+#endif
+
     uint64_t now = xtimer_now_usec64();
 
     size_t count = 0;
@@ -132,6 +389,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 
         if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
 
+            table->stats.compared++;
             int ret_comp = universal_address_compare(table->data.entries[i].global, dst, &match_size);
             /* If we found an exact match */
             if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
@@ -193,6 +451,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -202,9 +461,9 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
-                         size_t next_hop_size, uint32_t next_hop_flags,
-                         uint32_t lifetime)
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry,
+                         uint8_t *next_hop, size_t next_hop_size,
+                         uint32_t next_hop_flags, uint32_t lifetime)
 {
     universal_address_container_t *container = universal_address_add(next_hop, next_hop_size);
 
@@ -218,6 +477,7 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
 
     if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
         fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+        _fib_expiry(table, entry->lifetime);
     }
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
@@ -264,10 +524,12 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 
                 if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
                     fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
+                    _fib_expiry(table, table->data.entries[i].lifetime);
                 }
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
+                _fib_entry_index(table, &table->data.entries[i], true);
 
                 return 0;
             }
@@ -280,12 +542,15 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry belongs to
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
+    _fib_entry_index(table, entry, false);
+
     if (entry->global != NULL) {
         universal_address_rem(entry->global);
     }
@@ -404,7 +669,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -434,7 +699,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -458,7 +723,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -478,7 +743,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -507,6 +772,7 @@ int fib_get_next_hop(fib_table_t *table, kernel_pid_t *iface_id,
         return -EFAULT;
     }
 
+    table->stats.lookups++;
     int ret = fib_find_entry(table, dst, dst_size, &(entry[0]), &count);
     if (!(ret == 0 || ret == 1)) {
         /* notify all responsible RPs for unknown  next-hop for the destination address */
@@ -529,6 +795,7 @@ int fib_get_next_hop(fib_table_t *table, kernel_pid_t *iface_id,
         }
     }
     else {
+        table->stats.misses++;
         mutex_unlock(&(table->mtx_access));
         return -EHOSTUNREACH;
     }
@@ -598,6 +865,11 @@ void fib_init(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+#ifdef MODULE_FIB_RADIX
+    fib_radix_init(&table->radix);
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+#endif
+    memset(&table->stats, 0, sizeof(table->stats));
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
 }
@@ -623,6 +895,11 @@ void fib_deinit(fib_table_t *table)
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
     }
+#ifdef MODULE_FIB_RADIX
+    fib_radix_init(&table->radix);
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+#endif
+    memset(&table->stats, 0, sizeof(table->stats));
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
@@ -685,6 +962,7 @@ int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_i
             if (sr_lifetime < (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
                 fib_lifetime_to_absolute(sr_lifetime,
                                          &table->data.source_routes->headers[i].sr_lifetime);
+                _fib_expiry(table, table->data.source_routes->headers[i].sr_lifetime);
             }
             else {
                 table->data.source_routes->headers[i].sr_lifetime = FIB_LIFETIME_NO_EXPIRE;
@@ -703,16 +981,17 @@ int fib_sr_create(fib_table_t *table, fib_sr_t **fib_sr, kernel_pid_t sr_iface_i
 * @brief Internal function:
 *        checks the lifetime and removes the entry in case it expired
 */
-static int fib_sr_check_lifetime(fib_sr_t *fib_sr)
+static int fib_sr_check_lifetime(fib_table_t *table, fib_sr_t *fib_sr)
 {
     uint64_t tm = fib_sr->sr_lifetime - xtimer_now_usec64();
     /* check if the lifetime expired */
-    if ((int64_t)tm < 0) {
+    if ((fib_sr->sr_lifetime != FIB_LIFETIME_NO_EXPIRE) && ((int64_t)tm < 0)) {
         /* remove this sr if its lifetime expired */
         fib_sr->sr_lifetime = 0;
 
         if (fib_sr->sr_path != NULL) {
             fib_sr_entry_t *elt = NULL;
+            _fib_sr_index(table, fib_sr, false);
             LL_FOREACH(fib_sr->sr_path, elt) {
                 universal_address_rem(elt->address);
             }
@@ -754,10 +1033,13 @@ static int fib_sr_new_entry(fib_table_t *table, uint8_t *addr, size_t addr_size,
 */
 static int fib_is_sr_in_table(fib_table_t *table, fib_sr_t *fib_sr)
 {
-    for (size_t i = 0; i < table->size; ++i) {
-        if (&(table->data.source_routes->headers[i]) == fib_sr) {
-            return 0;
-        }
+    uintptr_t offset = (uintptr_t)fib_sr
+                       - (uintptr_t)table->data.source_routes->headers;
+
+    /* pointers before the headers wrap around to large offsets */
+    if ((offset < (table->size * sizeof(fib_sr_t)))
+        && ((offset % sizeof(fib_sr_t)) == 0)) {
+        return 0;
     }
     return -ENOENT;
 }
@@ -772,7 +1054,7 @@ int fib_sr_read_head(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *iface_i
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -795,7 +1077,7 @@ int fib_sr_read_destination(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -823,7 +1105,7 @@ int fib_sr_set(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *sr_iface_id,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -838,6 +1120,7 @@ int fib_sr_set(fib_table_t *table, fib_sr_t *fib_sr, kernel_pid_t *sr_iface_id,
 
     if (sr_lifetime != NULL) {
         fib_lifetime_to_absolute(*sr_lifetime, &(fib_sr->sr_lifetime));
+        _fib_expiry(table, fib_sr->sr_lifetime);
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -853,6 +1136,7 @@ int fib_sr_delete(fib_table_t *table, fib_sr_t *fib_sr)
     }
 
     fib_sr->sr_lifetime = 0;
+    _fib_sr_index(table, fib_sr, false);
 
     if (fib_sr->sr_path != NULL) {
         fib_sr_entry_t *elt = NULL, *tmp = NULL;
@@ -882,7 +1166,7 @@ int fib_sr_next(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_t **sr_path_e
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -916,7 +1200,7 @@ int fib_sr_search(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, size_t ad
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -949,7 +1233,7 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -968,6 +1252,7 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
 
     if (ret == 0) {
         fib_sr_entry_t *tmp = fib_sr->sr_dest;
+        _fib_sr_dest_index(table, fib_sr, false);
         if (tmp != NULL) {
             /* we append the new entry behind the former destination */
             tmp->next = new_entry[0];
@@ -977,6 +1262,8 @@ int fib_sr_entry_append(fib_table_t *table, fib_sr_t *fib_sr,
             fib_sr->sr_path = new_entry[0];
         }
         fib_sr->sr_dest = new_entry[0];
+        _fib_sr_hop_index(table, new_entry[0], true);
+        _fib_sr_dest_index(table, fib_sr, true);
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -994,7 +1281,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1018,6 +1305,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
         fib_sr_entry_t *new_entry[1];
         ret = fib_sr_new_entry(table, addr, addr_size, &new_entry[0]);
         if (ret == 0) {
+            _fib_sr_index(table, fib_sr, false);
             fib_sr_entry_t *remaining = sr_path_entry->next;
             sr_path_entry->next = new_entry[0];
             if (keep_remaining_route) {
@@ -1033,6 +1321,7 @@ int fib_sr_entry_add(fib_table_t *table, fib_sr_t *fib_sr,
                 new_entry[0]->next = NULL;
                 fib_sr->sr_dest = new_entry[0];
             }
+            _fib_sr_index(table, fib_sr, true);
         }
     }
 
@@ -1049,7 +1338,7 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1060,6 +1349,7 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
         size_t addr_size_match = addr_size << 3;
 
         if (universal_address_compare(elt->address, addr, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
+            _fib_sr_index(table, fib_sr, false);
             universal_address_rem(elt->address);
             if (keep_remaining_route) {
                 tmp->next = elt->next;
@@ -1080,12 +1370,14 @@ int fib_sr_entry_delete(fib_table_t *table, fib_sr_t *fib_sr, uint8_t *addr, siz
                 /* if we remove the last entry we must adjust the destination */
                 fib_sr->sr_dest = tmp;
             }
+            _fib_sr_index(table, fib_sr, true);
             mutex_unlock(&(table->mtx_access));
             return 0;
         }
         tmp = elt;
     }
 
+    mutex_unlock(&(table->mtx_access));
     return -ENOENT;
 }
 
@@ -1100,7 +1392,7 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1120,6 +1412,7 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
     }
 
     if (elt_repl != NULL) {
+        _fib_sr_index(table, fib_sr, false);
         universal_address_rem(elt_repl->address);
         universal_address_container_t *add = universal_address_add(addr_new, addr_new_size);
 
@@ -1129,10 +1422,12 @@ int fib_sr_entry_overwrite(fib_table_t *table, fib_sr_t *fib_sr,
              * so we add back the old entry, i.e. increasing the usecount
              */
             universal_address_add(addr_old, addr_old_size);
+            _fib_sr_index(table, fib_sr, true);
             mutex_unlock(&(table->mtx_access));
             return -ENOMEM;
         }
         elt_repl->address = add;
+        _fib_sr_index(table, fib_sr, true);
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -1148,7 +1443,7 @@ int fib_sr_entry_get_address(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_
         return -EFAULT;
     }
 
-    if (fib_sr_check_lifetime(fib_sr) == -ENOENT) {
+    if (fib_sr_check_lifetime(table, fib_sr) == -ENOENT) {
         mutex_unlock(&(table->mtx_access));
         return -ENOENT;
     }
@@ -1170,6 +1465,80 @@ int fib_sr_entry_get_address(fib_table_t *table, fib_sr_t *fib_sr, fib_sr_entry_
     return -ENOENT;
 }
 
+#ifdef MODULE_FIB_RADIX
+/**
+ * @brief helper function to get the position of the first free source route
+ *
+ * @param[in] table the fib table to search in
+ *
+ * @return the position of the first free source route
+ *         -1 if there is none
+ */
+static int _fib_sr_free_entry(fib_table_t *table)
+{
+    for (size_t i = 0; i < table->size; ++i) {
+        if (table->data.source_routes->headers[i].sr_lifetime == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief helper function to search a direct source route to a given
+ *        destination using the radix index, see Case 1 of fib_sr_get_route()
+ *
+ * @param[in] table the fib table to search in
+ * @param[in] dst pointer to the destination address bytes
+ * @param[in] dst_size the size in bytes of the destination address type
+ * @param[in] sr_flags the flags a perfect matching source route has
+ * @param[in] last the source route to continue the search after, or NULL
+ * @param[out] tmp_hit the last source route with distinct flags
+ *
+ * @return pointer to the perfect matching source route
+ *         NULL otherwise
+ */
+static fib_sr_t *_fib_sr_radix_find(fib_table_t *table, uint8_t *dst,
+                                    size_t dst_size, uint32_t sr_flags,
+                                    fib_sr_t *last, fib_sr_t **tmp_hit)
+{
+    uint8_t key[FIB_RADIX_KEY_SIZE];
+    fib_radix_node_t *node;
+
+    _fib_expire(table);
+    if ((last != NULL) && ((fib_is_sr_in_table(table, last) == -ENOENT)
+                           || (last->sr_lifetime == 0))) {
+        /* we cannot continue after a source route that is gone */
+        return NULL;
+    }
+    if (dst_size > UNIVERSAL_ADDRESS_SIZE) {
+        return NULL;
+    }
+    node = fib_radix_get(&table->radix, key,
+                         _fib_key(key, 0, dst, dst_size, dst_size << 3));
+    /* the source routes are ordered by their position in the table */
+    for (; node != NULL; node = node->dup) {
+        fib_sr_t *fib_sr = node->item;
+
+        if ((last != NULL) && ((uintptr_t)fib_sr <= (uintptr_t)last)) {
+            /* we skip all entries upon the consecutive one to start search */
+            continue;
+        }
+        table->stats.compared++;
+        if (sr_flags == fib_sr->sr_flags) {
+            /* found a perfect matching sr, no need to search further */
+            *tmp_hit = NULL;
+            return fib_sr;
+        }
+        /* found a sr to the destination but with different flags,
+         * maybe we find a better one.
+         */
+        *tmp_hit = fib_sr;
+    }
+    return NULL;
+}
+#endif
+
 /**
  * @brief helper function to search a partial path to a given destination,
  *         and iff successful to create a new source route
@@ -1187,12 +1556,29 @@ static fib_sr_t* _fib_create_sr_from_partial(fib_table_t *table, uint8_t *dst, s
                                              int check_free_entry, int *error) {
 fib_sr_t* hit = NULL;
 
+#ifdef MODULE_FIB_RADIX
+    if (fib_radix_usable(&table->radix)) {
+        uint8_t key[FIB_RADIX_KEY_SIZE];
+
+        if ((dst_size > UNIVERSAL_ADDRESS_SIZE) ||
+            (fib_radix_get(&table->radix, key,
+                           _fib_key(key, FIB_RADIX_NS_HOP, dst, dst_size,
+                                    dst_size << 3)) == NULL)) {
+            /* the destination is no hop of any source route */
+            return NULL;
+        }
+        /* expired source routes were already released by _fib_expire() */
+        check_free_entry = _fib_sr_free_entry(table);
+    }
+#endif
+
     for (size_t i = 0; i < table->size; ++i) {
         if (table->data.source_routes->headers[i].sr_lifetime != 0) {
 
             fib_sr_entry_t *elt = NULL;
             LL_FOREACH(table->data.source_routes->headers[i].sr_path, elt) {
                 size_t addr_size_match = dst_size << 3;
+                table->stats.compared++;
                 if (universal_address_compare(elt->address, dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
                     /* we create a new sr */
                     if (check_free_entry == -1) {
@@ -1249,6 +1635,8 @@ fib_sr_t* hit = NULL;
                                         /* we copied until the destination */
                                         new_sr->sr_dest = new_entry;
                                         hit = new_sr;
+                                        _fib_sr_index(table, new_sr, true);
+                                        _fib_expiry(table, new_sr->sr_lifetime);
 
                                         /* tell the RPs that a new sr has been created
                                          * the size and the flags parameters are ignored
@@ -1300,10 +1688,18 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
     int check_free_entry = -1;
 
     bool skip = (fib_sr != NULL) && (*fib_sr != NULL)?true:false;
+    table->stats.lookups++;
+#ifdef MODULE_FIB_RADIX
+    if (fib_radix_usable(&table->radix)) {
+        hit = _fib_sr_radix_find(table, dst, dst_size, *sr_flags,
+                                 skip ? *fib_sr : NULL, &tmp_hit);
+    }
+    else
+#endif
     /* Case 1 - check if we know a direct route */
     for (size_t i = 0; i < table->size; ++i) {
 
-        if (fib_sr_check_lifetime(&table->data.source_routes->headers[i]) == -ENOENT) {
+        if (fib_sr_check_lifetime(table, &table->data.source_routes->headers[i]) == -ENOENT) {
             /* expired, so skip this sr and remember its position */
             if (check_free_entry == -1) {
                 /* we want to fill up the source routes from the beginning */
@@ -1321,6 +1717,7 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
         }
 
         size_t addr_size_match = dst_size << 3;
+        table->stats.compared++;
         if (universal_address_compare(table->data.source_routes->headers[i].sr_dest->address,
                                       dst, &addr_size_match) == UNIVERSAL_ADDRESS_EQUAL) {
             if (*sr_flags == table->data.source_routes->headers[i].sr_flags) {
@@ -1363,6 +1760,7 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
              */
             if (hit != NULL) {
                 hit->sr_lifetime = 0;
+                _fib_sr_index(table, hit, false);
 
                 if (hit->sr_path != NULL) {
                     fib_sr_entry_t *elt = NULL, *tmp = NULL;
@@ -1425,6 +1823,7 @@ int fib_sr_get_route(fib_table_t *table, uint8_t *dst, size_t dst_size, kernel_p
     else {
 
         /* trigger RPs for route discovery */
+        table->stats.misses++;
         fib_signal_rp(table, FIB_MSG_RP_SIGNAL_UNREACHABLE_DESTINATION, dst, dst_size, *sr_flags);
 
         mutex_unlock(&(table->mtx_access));
@@ -1497,6 +1896,38 @@ void fib_print_sr(fib_table_t *table, fib_sr_t *sr)
     mutex_unlock(&(table->mtx_access));
 }
 
+void fib_print_stats(fib_table_t *table)
+{
+    mutex_lock(&(table->mtx_access));
+
+    printf("lookups: %" PRIu32 ", misses: %" PRIu32 ", entries compared: %" PRIu32 "\n",
+           table->stats.lookups, table->stats.misses, table->stats.compared);
+#ifdef MODULE_FIB_RADIX
+    if (fib_radix_usable(&table->radix)) {
+        printf("index: radix, %u of %u nodes used\n",
+               (unsigned)table->radix.nodes_used,
+               (unsigned)table->radix.nodes_numof);
+    }
+    else if (table->radix.overflow) {
+        printf("index: none, all %u radix nodes used up\n",
+               (unsigned)table->radix.nodes_numof);
+    }
+    else
+#endif
+    {
+        puts("index: none");
+    }
+
+    mutex_unlock(&(table->mtx_access));
+}
+
+void fib_reset_stats(fib_table_t *table)
+{
+    mutex_lock(&(table->mtx_access));
+    memset(&table->stats, 0, sizeof(table->stats));
+    mutex_unlock(&(table->mtx_access));
+}
+
 static void fib_print_address(universal_address_container_t *entry)
 {
     uint8_t address[UNIVERSAL_ADDRESS_SIZE];
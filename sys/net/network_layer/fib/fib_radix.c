@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_fib_radix
+ * @{
+ *
+ * @file
+ * @brief       Radix index for FIB tables
+ *
+ * A node either holds items with exactly its key or branches into two
+ * sub-tries at bit fib_radix_node_t::key_len. Further items with the same key
+ * are chained to the node in the trie via fib_radix_node_t::dup.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "net/fib/radix.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#ifdef MODULE_FIB_RADIX
+
+static inline unsigned _bit(const uint8_t *key, unsigned pos)
+{
+    return (key[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+/* number of leading bits a and b have in common, at most max */
+static unsigned _match(const uint8_t *a, const uint8_t *b, unsigned max)
+{
+    unsigned bits = 0;
+
+    for (unsigned i = 0; bits < max; i++) {
+        uint8_t diff = a[i] ^ b[i];
+
+        if (diff != 0) {
+            while (!(diff & 0x80)) {
+                diff <<= 1;
+                bits++;
+            }
+            break;
+        }
+        bits += 8;
+    }
+    return (bits > max) ? max : bits;
+}
+
+static int _overflow(fib_radix_t *radix)
+{
+    DEBUG("fib_radix: node pool of %u nodes exhausted\n",
+          (unsigned)radix->nodes_numof);
+    radix->overflow = true;
+    return -ENOMEM;
+}
+
+static fib_radix_node_t *_node_alloc(fib_radix_t *radix, const uint8_t *key,
+                                     unsigned key_len, void *item)
+{
+    fib_radix_node_t *node = radix->free;
+
+    if (node != NULL) {
+        radix->free = node->child[0];
+    }
+    else {
+        assert(radix->nodes_next < radix->nodes_numof);
+        node = &radix->nodes[radix->nodes_next++];
+    }
+    radix->nodes_used++;
+    memset(node, 0, sizeof(fib_radix_node_t));
+    memcpy(node->key, key, (key_len + 7) >> 3);
+    if (key_len & 0x7) {
+        node->key[key_len >> 3] &= (uint8_t)(0xff << (8 - (key_len & 0x7)));
+    }
+    node->key_len = key_len;
+    node->item = item;
+    return node;
+}
+
+static inline void _node_free(fib_radix_t *radix, fib_radix_node_t *node)
+{
+    node->child[0] = radix->free;
+    radix->free = node;
+    radix->nodes_used--;
+}
+
+void fib_radix_init(fib_radix_t *radix)
+{
+    radix->nodes_used = 0;
+    radix->nodes_next = 0;
+    radix->root = NULL;
+    radix->free = NULL;
+    radix->overflow = false;
+}
+
+int fib_radix_insert(fib_radix_t *radix, const uint8_t *key, unsigned key_len,
+                     void *item)
+{
+    fib_radix_node_t **ptr = &radix->root;
+    fib_radix_node_t *node;
+    size_t avail = radix->nodes_numof - radix->nodes_used;
+
+    assert(item != NULL);
+    assert(key_len <= (FIB_RADIX_KEY_SIZE << 3));
+    while ((node = *ptr) != NULL) {
+        unsigned max = (node->key_len < key_len) ? node->key_len : key_len;
+        unsigned match = _match(node->key, key, max);
+
+        if (match >= node->key_len) {
+            if (node->key_len == key_len) {
+                break;
+            }
+            ptr = &node->child[_bit(key, node->key_len)];
+            continue;
+        }
+        /* key diverges from or is shorter than the one of node */
+        if (avail < ((match == key_len) ? 1U : 2U)) {
+            return _overflow(radix);
+        }
+        fib_radix_node_t *leaf = _node_alloc(radix, key, key_len, item);
+
+        if (match == key_len) {
+            leaf->child[_bit(node->key, match)] = node;
+            *ptr = leaf;
+        }
+        else {
+            fib_radix_node_t *branch = _node_alloc(radix, key, match, NULL);
+
+            branch->child[_bit(key, match)] = leaf;
+            branch->child[_bit(node->key, match)] = node;
+            *ptr = branch;
+        }
+        return 0;
+    }
+    if (node == NULL) {
+        if (avail < 1) {
+            return _overflow(radix);
+        }
+        *ptr = _node_alloc(radix, key, key_len, item);
+        return 0;
+    }
+    if (node->item == NULL) {
+        /* branch node becomes a node holding items */
+        node->item = item;
+        return 0;
+    }
+    if (avail < 1) {
+        return _overflow(radix);
+    }
+    /* keep items in the order of their addresses, the node in the trie holds
+     * the first one */
+    fib_radix_node_t *dup = _node_alloc(radix, key, key_len, item);
+
+    if ((uintptr_t)item < (uintptr_t)node->item) {
+        dup->item = node->item;
+        node->item = item;
+    }
+    else {
+        while ((node->dup != NULL) &&
+               ((uintptr_t)node->dup->item < (uintptr_t)item)) {
+            node = node->dup;
+        }
+    }
+    dup->dup = node->dup;
+    node->dup = dup;
+    return 0;
+}
+
+void fib_radix_remove(fib_radix_t *radix, const uint8_t *key, unsigned key_len,
+                      void *item)
+{
+    fib_radix_node_t **parent = NULL, **ptr = &radix->root;
+    fib_radix_node_t *node;
+
+    while (((node = *ptr) != NULL) && (node->key_len < key_len)) {
+        parent = ptr;
+        ptr = &node->child[_bit(key, node->key_len)];
+    }
+    if ((node == NULL) || (node->key_len != key_len) ||
+        (_match(node->key, key, key_len) < key_len)) {
+        return;
+    }
+    if (node->item != item) {
+        for (fib_radix_node_t *prev = node; prev->dup != NULL;
+             prev = prev->dup) {
+            if (prev->dup->item == item) {
+                fib_radix_node_t *dup = prev->dup;
+
+                prev->dup = dup->dup;
+                _node_free(radix, dup);
+                break;
+            }
+        }
+        return;
+    }
+    if (node->dup != NULL) {
+        /* next item with the same key takes the place in the trie */
+        fib_radix_node_t *dup = node->dup;
+
+        node->item = dup->item;
+        node->dup = dup->dup;
+        _node_free(radix, dup);
+        return;
+    }
+    node->item = NULL;
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        /* node becomes a branch node */
+        return;
+    }
+    *ptr = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _node_free(radix, node);
+    if ((*ptr == NULL) && (parent != NULL) && ((*parent)->item == NULL)) {
+        /* branch node above is left with a single sub-trie */
+        node = *parent;
+        *parent = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+        _node_free(radix, node);
+    }
+}
+
+fib_radix_node_t *fib_radix_get(const fib_radix_t *radix, const uint8_t *key,
+                                unsigned key_len)
+{
+    fib_radix_node_t *node = radix->root;
+
+    while ((node != NULL) && (node->key_len < key_len)) {
+        node = node->child[_bit(key, node->key_len)];
+    }
+    if ((node != NULL) && (node->item != NULL) &&
+        (node->key_len == key_len) &&
+        (_match(node->key, key, key_len) >= key_len)) {
+        return node;
+    }
+    return NULL;
+}
+
+fib_radix_node_t *fib_radix_match(const fib_radix_t *radix,
+                                  const fib_radix_node_t *last,
+                                  const uint8_t *key, unsigned key_len)
+{
+    fib_radix_node_t *node;
+
+    if (last == NULL) {
+        node = radix->root;
+    }
+    else if (last->key_len < key_len) {
+        node = last->child[_bit(key, last->key_len)];
+    }
+    else {
+        return NULL;
+    }
+    while ((node != NULL) && (node->key_len <= key_len)) {
+        /* keys of branch nodes are implicitly checked with the next node
+         * holding items below them */
+        if (node->item != NULL) {
+            if (_match(node->key, key, node->key_len) < node->key_len) {
+                break;
+            }
+            return node;
+        }
+        if (node->key_len == key_len) {
+            break;
+        }
+        node = node->child[_bit(key, node->key_len)];
+    }
+    return NULL;
+}
+
+#else
+typedef int dont_be_pedantic;
+#endif /* MODULE_FIB_RADIX */
@@ -68,6 +68,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime | switches"
+#endif
+#if defined(MODULE_SCHEDSTATISTICS) && defined(MODULE_CORE_SCHED_EDF)
+           " | misses"
 #endif
            "\n",
 #ifdef DEVELHELP
@@ -130,6 +133,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u"
+#endif
+#if defined(MODULE_SCHEDSTATISTICS) && defined(MODULE_CORE_SCHED_EDF)
+                   " | %6u"
 #endif
                    "\n",
                    p->pid,
@@ -145,6 +151,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches
+#endif
+#if defined(MODULE_SCHEDSTATISTICS) && defined(MODULE_CORE_SCHED_EDF)
+                   , sched_pidlist[i].deadline_misses
 #endif
                   );
         }
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_edf
+ * @{
+ *
+ * @file
+ * @brief       Periodic threads of the earliest deadline first class
+ *
+ * The deadline ordered run queue itself lives in core/sched.c, this file
+ * creates periodic threads and releases their jobs with xtimer.
+ *
+ * @}
+ */
+
+#include <errno.h>
+
+#include "assert.h"
+#include "irq.h"
+#include "sched.h"
+#include "sched_edf.h"
+#include "thread.h"
+#include "xtimer.h"
+
+kernel_pid_t thread_create_edf(char *stack, int stacksize, uint32_t period,
+                               uint32_t deadline, int flags,
+                               thread_task_func_t function, void *arg,
+                               const char *name)
+{
+    if (!period) {
+        return -EINVAL;
+    }
+
+    /* the deadline has to be in place before the thread enters the run queue */
+    kernel_pid_t pid = thread_create(stack, stacksize, THREAD_PRIORITY_EDF,
+                                     THREAD_CREATE_SLEEPING | (flags & THREAD_CREATE_STACKTEST),
+                                     function, arg, name);
+    if (pid < 0) {
+        return pid;
+    }
+
+    thread_t *thread = (thread_t *)sched_threads[pid];
+    uint32_t now = xtimer_now_usec();
+
+    thread->edf_period = period;
+    thread->edf_rel_deadline = deadline;
+    thread->edf_release = now;
+    thread->edf_deadline = now + deadline;
+#ifdef MODULE_SCHEDSTATISTICS
+    sched_pidlist[pid].deadline_misses = 0;
+#endif
+
+    if (!(flags & THREAD_CREATE_SLEEPING)) {
+        unsigned state = irq_disable();
+        sched_set_status(thread, STATUS_PENDING);
+        irq_restore(state);
+
+        if (!(flags & THREAD_CREATE_WOUT_YIELD)) {
+            sched_switch(THREAD_PRIORITY_EDF);
+        }
+    }
+
+    return pid;
+}
+
+static void _edf_release(void *arg)
+{
+    thread_t *thread = arg;
+
+    /* not on the run queue while sleeping, so the deadline can move freely */
+    thread->edf_deadline = thread->edf_release + thread->edf_rel_deadline;
+    thread_wakeup(thread->pid);
+}
+
+void thread_edf_wait_period(void)
+{
+    thread_t *me = (thread_t *)sched_active_thread;
+    xtimer_t timer = { .callback = _edf_release, .arg = me };
+
+    assert(me->edf_period);
+
+    uint32_t now = xtimer_now_usec();
+
+#ifdef MODULE_SCHEDSTATISTICS
+    if ((int32_t)(now - me->edf_deadline) > 0) {
+        sched_pidlist[me->pid].deadline_misses++;
+    }
+#endif
+
+    uint32_t release = me->edf_release + me->edf_period;
+    while ((int32_t)(now - release) > 0) {
+        release += me->edf_period;
+    }
+    me->edf_release = release;
+
+    unsigned state = irq_disable();
+    uint32_t left = release - now;
+    if (xtimer_ticks_from_usec(left).ticks32 < XTIMER_BACKOFF) {
+        /* too close to sleep, requeue right away with the new deadline */
+        sched_set_status(me, STATUS_SLEEPING);
+        me->edf_deadline = release + me->edf_rel_deadline;
+        sched_set_status(me, STATUS_RUNNING);
+    }
+    else {
+        /* interrupts stay off until we sleep, so the release can't be lost */
+        xtimer_set(&timer, left);
+        sched_set_status(me, STATUS_SLEEPING);
+    }
+    irq_restore(state);
+
+    thread_yield_higher();
+
+    /* woken up early by thread_wakeup(), the timer lives on this stack */
+    xtimer_remove(&timer);
+}
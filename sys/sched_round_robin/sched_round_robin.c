@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_round_robin
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling implementation
+ *
+ * @}
+ */
+
+#include "clist.h"
+#include "sched.h"
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static void _rotate(void *arg);
+
+static xtimer_t _timer = { .callback = _rotate };
+
+/* thread whose time slice is running, KERNEL_PID_UNDEF while disarmed */
+static kernel_pid_t _slice_pid = KERNEL_PID_UNDEF;
+
+static void _rotate(void *arg)
+{
+    (void)arg;
+
+    thread_t *active = (thread_t *)sched_active_thread;
+    clist_node_t *rq = &sched_runqueues[active->priority];
+
+    _slice_pid = KERNEL_PID_UNDEF;
+
+    /* the active thread sits at the head of its run queue while it runs */
+    if ((active->status >= STATUS_ON_RUNQUEUE)
+        && (clist_lpeek(rq) == &active->rq_entry)) {
+        DEBUG("sched_rr: rotating priority %u\n", (unsigned)active->priority);
+        clist_lpoprpush(rq);
+        thread_yield_higher();
+    }
+}
+
+void sched_round_robin_update(void)
+{
+    thread_t *active = (thread_t *)sched_active_thread;
+
+    if (active == NULL) {
+        return;
+    }
+
+    clist_node_t *rq = &sched_runqueues[active->priority];
+    int contended = (active->status >= STATUS_ON_RUNQUEUE)
+                    && (rq->next != NULL) && (rq->next->next != rq->next);
+
+#ifdef MODULE_CORE_SCHED_EDF
+    contended = contended && (active->priority != THREAD_PRIORITY_EDF);
+#endif
+
+    if (contended) {
+        /* every thread gets a fresh slice when it starts running */
+        if (_slice_pid != active->pid) {
+            _slice_pid = active->pid;
+            xtimer_set(&_timer, SCHED_RR_QUANTUM);
+        }
+    }
+    else if (_slice_pid != KERNEL_PID_UNDEF) {
+        _slice_pid = KERNEL_PID_UNDEF;
+        xtimer_remove(&_timer);
+    }
+}
@@ -49,7 +49,8 @@ static void _fib_usage(int info)
     switch (info) {
         case 0: {
             puts("\nsee <fibroute [add|del]> for more information\n"
-                 "<fibroute flush [interface]> removes all entries [associated with interface]\n");
+                 "<fibroute flush [interface]> removes all entries [associated with interface]\n"
+                 "<fibroute stats [reset]> shows [resets] the lookup statistics\n");
             break;
         }
         case 1: {
@@ -147,6 +148,10 @@ int _fib_route_handler(int argc, char **argv)
             fib_flush(&gnrc_ipv6_fib_table, KERNEL_PID_UNDEF);
             puts("successfully flushed all entries");
         }
+        else if ((strcmp("stats", argv[1]) == 0)) {
+            fib_print_stats(&gnrc_ipv6_fib_table);
+            return 0;
+        }
         else {
             _fib_usage(0);
         }
@@ -156,14 +161,23 @@ int _fib_route_handler(int argc, char **argv)
 
     if (argc > 2 && !((strcmp("add", argv[1]) == 0) ||
                       (strcmp("del", argv[1]) == 0) ||
-                      (strcmp("flush", argv[1]) == 0))) {
+                      (strcmp("flush", argv[1]) == 0) ||
+                      (strcmp("stats", argv[1]) == 0))) {
         puts("\nunrecognized parameter2.\nPlease enter fibroute [add|del] for more information.");
         return 1;
     }
 
     /* e.g. fibroute del <destination> */
     if (argc == 3) {
-        if ((strcmp("flush", argv[1]) == 0)) {
+        if ((strcmp("stats", argv[1]) == 0)) {
+            if (strcmp("reset", argv[2]) != 0) {
+                _fib_usage(0);
+                return 1;
+            }
+            fib_reset_stats(&gnrc_ipv6_fib_table);
+            puts("successfully reset the statistics");
+        }
+        else if ((strcmp("flush", argv[1]) == 0)) {
             kernel_pid_t iface = atoi(argv[2]);
             if (gnrc_netif_get_by_pid(iface) != NULL) {
                 fib_flush(&gnrc_ipv6_fib_table, iface);
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/sixlowpan/frag.h"
+
+int _gnrc_6lo_frag(int argc, char **argv)
+{
+    if (argc > 1) {
+        if (strcmp(argv[1], "reset") == 0) {
+            gnrc_sixlowpan_frag_rbuf_reset_stats();
+            return 0;
+        }
+        printf("usage: %s [reset]\n", argv[0]);
+        return 1;
+    }
+
+    const gnrc_sixlowpan_frag_rbuf_stats_t *stats = gnrc_sixlowpan_frag_rbuf_stats();
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+    puts("rbuf: hashed");
+#else
+    puts("rbuf: linear");
+#endif
+    printf("rbuf: %lu evictions, %lu timeouts, %lu duplicates, %lu overlaps\n",
+           (unsigned long)stats->evictions, (unsigned long)stats->timeouts,
+           (unsigned long)stats->duplicates, (unsigned long)stats->overlaps);
+    return 0;
+}
+
+/** @} */
@@ -142,6 +142,36 @@ static int _netif_stats(kernel_pid_t iface, unsigned module, bool reset)
 }
 #endif /* MODULE_NETSTATS */
 
+#ifdef MODULE_GNRC_NETIF_POLL
+static int _netif_poll_stats(kernel_pid_t iface, bool reset)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(iface);
+
+    if (reset) {
+        gnrc_netif_acquire(netif);
+        netif->poll.events = 0;
+        netif->poll.polls = 0;
+        netif->poll.frames = 0;
+        netif->poll.budget_exhausted = 0;
+        netif->poll.queue_drops = 0;
+        gnrc_netif_release(netif);
+        puts("Reset receive polling statistics!");
+    }
+    else {
+        printf("          Receive polling (budget %u)\n"
+               "            events %"PRIu32"  polls %"PRIu32"  frames %"PRIu32"\n"
+               "            budget exhausted %"PRIu32"  queue drops %"PRIu32"\n",
+               (unsigned)GNRC_NETIF_RX_BUDGET,
+               netif->poll.events,
+               netif->poll.polls,
+               netif->poll.frames,
+               netif->poll.budget_exhausted,
+               netif->poll.queue_drops);
+    }
+    return 0;
+}
+#endif /* MODULE_GNRC_NETIF_POLL */
+
 static void _set_usage(char *cmd_name)
 {
     printf("usage: %s <if_id> set <key> <value>\n", cmd_name);
@@ -602,6 +632,10 @@ static void _netif_list(kernel_pid_t iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#ifdef MODULE_GNRC_NETIF_POLL
+    puts("");
+    _netif_poll_stats(iface, false);
 #endif
     puts("");
 }
@@ -989,6 +1023,13 @@ static void _l2filter_usage(const char *cmd)
 }
 #endif
 
+#ifdef MODULE_GNRC_NETIF_POLL
+static void _poll_usage(const char *cmd)
+{
+    printf("usage: %s <if_id> poll [reset]\n", cmd);
+}
+#endif
+
 static void _usage(char *cmd)
 {
     printf("usage: %s\n", cmd);
@@ -1002,6 +1043,9 @@ static void _usage(char *cmd)
 #ifdef MODULE_NETSTATS
     _stats_usage(cmd);
 #endif
+#ifdef MODULE_GNRC_NETIF_POLL
+    _poll_usage(cmd);
+#endif
 }
 
 static int _netif_set(char *cmd_name, kernel_pid_t iface, char *key, char *value)
@@ -1327,6 +1371,15 @@ int _gnrc_netif_config(int argc, char **argv)
                 return 1;
             }
 #endif
+#ifdef MODULE_GNRC_NETIF_POLL
+            else if (strcmp(argv[2], "poll") == 0) {
+                if ((argc > 3) && (strcmp(argv[3], "reset") != 0)) {
+                    _poll_usage(argv[0]);
+                    return 1;
+                }
+                return _netif_poll_stats((kernel_pid_t)iface, (argc > 3));
+            }
+#endif
 #ifdef MODULE_NETSTATS
             else if (strcmp(argv[2], "stats") == 0) {
                 uint8_t module;
@@ -111,6 +111,10 @@ extern int _gnrc_pktbuf_cmd(int argc, char **argv);
 extern int _gnrc_rpl(int argc, char **argv);
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+extern int _gnrc_6lo_frag(int argc, char **argv);
+#endif
+
 #ifdef MODULE_GNRC_SIXLOWPAN_CTX
 #ifdef MODULE_GNRC_IPV6_NIB_6LBR
 extern int _gnrc_6ctx(int argc, char **argv);
@@ -198,7 +202,7 @@ const shell_command_t _shell_command_list[] = {
 #endif
 #endif
 #ifdef MODULE_FIB
-    {"fibroute", "Manipulate the FIB (info: 'fibroute [add|del]')", _fib_route_handler},
+    {"fibroute", "Manipulate the FIB (info: 'fibroute [add|del|stats]')", _fib_route_handler},
 #endif
 #ifdef MODULE_GNRC_IPV6_WHITELIST
     {"whitelist", "whitelists an address for receival ('whitelist [add|del|help]')", _whitelist },
@@ -212,6 +216,9 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_GNRC_RPL
     {"rpl", "rpl configuration tool ('rpl help' for more information)", _gnrc_rpl },
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+    {"6lo_frag", "6LoWPAN reassembly buffer statistics ('6lo_frag [reset]')", _gnrc_6lo_frag },
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_CTX
 #ifdef MODULE_GNRC_IPV6_NIB_6LBR
     {"6ctx", "6LoWPAN context configuration tool", _gnrc_6ctx },
@@ -17,65 +17,43 @@
  * @}
  */
 
-#include "tsrb.h"
+#include <limits.h>
+#include <stdint.h>
 
-static void _push(tsrb_t *rb, char c)
-{
-    rb->buf[rb->writes++ & (rb->size - 1)] = c;
-}
+#include "tsrb.h"
 
-static char _pop(tsrb_t *rb)
+/* the ring works with unsigned lengths, larger requests are capped */
+static inline unsigned _cap(size_t n)
 {
-    return rb->buf[rb->reads++ & (rb->size - 1)];
+#if SIZE_MAX > UINT_MAX
+    if (n > UINT_MAX) {
+        return UINT_MAX;
+    }
+#endif
+    return n;
 }
 
 int tsrb_get_one(tsrb_t *rb)
 {
-    if (!tsrb_empty(rb)) {
-        return _pop(rb);
-    }
-    else {
-        return -1;
-    }
+    return spsc_ring_get_one(rb);
 }
 
 int tsrb_get(tsrb_t *rb, char *dst, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
-    }
-    return (n - tmp);
+    return spsc_ring_read(rb, dst, _cap(n));
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
-    }
-    return (n - tmp);
+    return spsc_ring_consume(rb, _cap(n));
 }
 
 int tsrb_add_one(tsrb_t *rb, char c)
 {
-    if (!tsrb_full(rb)) {
-        _push(rb, c);
-        return 0;
-    }
-    else {
-        return -1;
-    }
+    return spsc_ring_put_one(rb, c);
 }
 
 int tsrb_add(tsrb_t *rb, const char *src, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
-    }
-    return (n - tmp);
+    return spsc_ring_write(rb, src, _cap(n));
 }
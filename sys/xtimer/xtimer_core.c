@@ -68,7 +68,7 @@ static void _remove(xtimer_t *timer);
 
 #ifdef TIMER_64BIT_HW
 static inline void _lltimer_set(uint64_t target);
-static uint64_t _time_left(uint64_t target, uint64_t reference);
+static uint64_t _time_left(uint64_t target);
 #else
 static inline void _lltimer_set(uint32_t target);
 static uint32_t _time_left(uint32_t target, uint32_t reference);
@@ -85,13 +85,17 @@ static inline int _this_high_period(uint32_t target);
 
 static inline int _is_set(xtimer_t *timer)
 {
+#ifdef TIMER_64BIT_HW
+    return (timer->target64 != 0);
+#else
     return (timer->target || timer->long_target);
+#endif
 }
 
 #ifdef TIMER_64BIT_HW
 static inline void xtimer_spin_until(uint64_t target) {
-    while (_xtimer_lltimer_now64() > target);
-    while (_xtimer_lltimer_now64() < target);
+    /* the 64 bit counter never wraps, no need to wait for an overflow */
+    while (_xtimer_lltimer_now64() < target) {}
 }
 #else
 static inline void xtimer_spin_until(uint32_t target) {
@@ -304,6 +308,8 @@ int _xtimer_set_absolute64(xtimer_t *timer, uint64_t target)
 	    now = _xtimer_now64();
 	    if (target < now) {
 	    	DEBUG("timer_set_absolute64(): Oops. Target is in the past.\n");
+	    	/* unlink the timer again before firing it */
+	    	timer_list_head = timer->next;
 	    	timer->target64 = 0;
 	        _shoot(timer);
 	        irq_restore(state);
@@ -516,13 +522,9 @@ void xtimer_remove(xtimer_t *timer)
 
 #ifdef TIMER_64BIT_HW
 
-static uint64_t _time_left(uint64_t target, uint64_t reference)
+static uint64_t _time_left(uint64_t target)
 {
-    uint64_t now = _xtimer_lltimer_now();
-
-    if (now < reference) {
-        return 0;
-    }
+    uint64_t now = _xtimer_lltimer_now64();
 
     if (target > now) {
         return target - now;
@@ -692,29 +694,19 @@ static void _next_period(void)
 static void _timer_callback(void)
 {
     uint64_t next_target;
-    uint64_t reference;
 
     _in_handler = 1;
 
-    DEBUG("_timer_callback() now=%" PRIu64 " (%" PRIu64 ")pleft=%" PRIu64 "\n",
-          xtimer_now64().ticks64, _xtimer_lltimer_mask(xtimer_now64().ticks64),
-          0xffffffffffffffffl - xtimer_now64().ticks64);
+    DEBUG("_timer_callback() now=%" PRIu64 "\n", xtimer_now64().ticks64);
 
-    if (!timer_list_head) {
-    	core_panic(PANIC_ASSERT_FAIL, "Unexpected timer callback");
-    }
-    else {
-        /* we ended up in _timer_callback and there is
-         * a timer waiting.
-         */
-        /* set our period reference to the current time. */
-        reference = _xtimer_lltimer_now64();
-    }
+    /* With a 64 bit low-level timer there are no overflow ticks. An empty
+     * list means the head timer was removed while its callback was already
+     * pending, so there is nothing to do but to re-arm below. */
 
     /* check if next timers are close to expiring */
-    while (timer_list_head && (_time_left(timer_list_head->target, reference) < XTIMER_ISR_BACKOFF)) {
+    while (timer_list_head && (_time_left(timer_list_head->target64) < XTIMER_ISR_BACKOFF)) {
         /* make sure we don't fire too early */
-        while (_time_left(timer_list_head->target, reference)) {}
+        while (_time_left(timer_list_head->target64)) {}
 
         /* pick first timer in list */
         xtimer_t *timer = timer_list_head;
@@ -723,20 +715,15 @@ static void _timer_callback(void)
         timer_list_head = timer->next;
 
         /* make sure timer is recognized as being already fired */
-        timer->target = 0;
-        timer->long_target = 0;
+        timer->target64 = 0;
 
         /* fire timer */
         _shoot(timer);
     }
 
-    if (reference > _xtimer_lltimer_now64()) {
-    	core_panic(PANIC_ASSERT_FAIL, "64 Bit timer overflow");
-    }
-
     if (timer_list_head) {
         /* schedule callback on next timer target time */
-        next_target = timer_list_head->target - XTIMER_OVERHEAD;
+        next_target = timer_list_head->target64 - XTIMER_OVERHEAD;
     }
     else {
         /* there's no timer planned for this timer period */
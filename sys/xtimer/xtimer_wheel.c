@@ -0,0 +1,388 @@
+/**
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup sys_xtimer
+ *
+ * @{
+ * @file
+ * @brief xtimer core functionality based on a hierarchical timing wheel
+ *
+ * Timers are kept in 2^XTIMER_WHEEL_BITS slots on each of XTIMER_WHEEL_LEVELS
+ * levels. A timer is stored on the level of the most significant bit in which
+ * its target differs from the wheel's reference time (`_base`), in the slot
+ * given by the target's bits of that level. All timers in a level 0 slot thus
+ * share the exact same target, all timers in a higher level slot are due at
+ * or after the slot's start time.
+ *
+ * The low-level timer is always set to the start of the first occupied slot.
+ * When it is reached, level 0 slots are fired, higher level slots are
+ * cascaded, i.e., their timers are re-distributed to lower levels in one
+ * batch.
+ *
+ * Each slot is a doubly linked list (`next`/`pprev`) so that insertion and
+ * removal take constant time.
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "board.h"
+#include "periph/timer.h"
+#include "periph_conf.h"
+
+#include "bitarithm.h"
+#include "xtimer.h"
+#include "irq.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#ifndef TIMER_64BIT_HW
+#error "xtimer_wheel requires a 64 bit low-level timer (TIMER_64BIT_HW)"
+#endif
+
+#if XTIMER_WHEEL_BITS > 5
+#error "XTIMER_WHEEL_BITS must not exceed 5"
+#endif
+
+#define WHEEL_SLOTS         (1U << XTIMER_WHEEL_BITS)
+#define WHEEL_SLOT_MASK     (WHEEL_SLOTS - 1)
+#define WHEEL_SPAN_BITS     (XTIMER_WHEEL_BITS * XTIMER_WHEEL_LEVELS)
+#define LEVEL_FAR           (XTIMER_WHEEL_LEVELS)
+#define LEVEL_NONE          (-1)
+#define LLTIMER_IDLE        (0xFFFFFFFFFFFFFFFFUL)
+#define COOKIE_MAGIC        ((uintptr_t)0xa5c3e1f00f1e3c5aULL)
+
+static volatile int _in_handler = 0;
+
+static xtimer_t *_wheel[XTIMER_WHEEL_LEVELS][WHEEL_SLOTS];
+static unsigned _occupied[XTIMER_WHEEL_LEVELS];
+static xtimer_t *_far_list = NULL;
+static unsigned _numof = 0;
+static uint64_t _base = 0;
+static uint64_t _armed = LLTIMER_IDLE;
+
+static void _timer_callback(void);
+static void _periph_timer_callback(void *arg, int chan);
+
+/* like the list based implementation, timers passed to xtimer_remove() or set
+ * for the first time may contain garbage. Only trust pprev if the cookie
+ * matches the timer's address. */
+static inline int _is_set(xtimer_t *timer)
+{
+    return (timer->target64 != 0) &&
+           (timer->cookie == ((uintptr_t)timer ^ COOKIE_MAGIC));
+}
+
+static inline void xtimer_spin_until(uint64_t target)
+{
+    while (_xtimer_lltimer_now64() < target) {}
+}
+
+static inline void _shoot(xtimer_t *timer)
+{
+    timer->callback(timer->arg);
+}
+
+static inline void _lltimer_set(uint64_t target)
+{
+    if (_in_handler) {
+        return;
+    }
+    DEBUG("_lltimer_set(): setting %" PRIu64 "\n", target);
+    _armed = target;
+    timer_set_absolute(XTIMER_DEV, XTIMER_CHAN, target);
+}
+
+static void _link(xtimer_t **head, xtimer_t *timer)
+{
+    timer->next = *head;
+    if (timer->next) {
+        timer->next->pprev = &timer->next;
+    }
+    *head = timer;
+    timer->pprev = head;
+    timer->cookie = (uintptr_t)timer ^ COOKIE_MAGIC;
+}
+
+static void _unlink(xtimer_t *timer)
+{
+    xtimer_t **pprev = timer->pprev;
+
+    *pprev = timer->next;
+    if (timer->next) {
+        timer->next->pprev = pprev;
+    }
+    else if ((pprev >= &_wheel[0][0]) &&
+             (pprev < &_wheel[0][0] + (XTIMER_WHEEL_LEVELS * WHEEL_SLOTS))) {
+        /* pprev is a slot head, clear its occupancy bit if it became empty */
+        if (!*pprev) {
+            unsigned idx = pprev - &_wheel[0][0];
+            _occupied[idx / WHEEL_SLOTS] &= ~(1U << (idx % WHEEL_SLOTS));
+        }
+    }
+}
+
+static void _insert(xtimer_t *timer)
+{
+    uint64_t diff = timer->target64 ^ _base;
+
+    if (diff >> WHEEL_SPAN_BITS) {
+        _link(&_far_list, timer);
+        return;
+    }
+
+    unsigned level = 0;
+    while (diff >>= XTIMER_WHEEL_BITS) {
+        level++;
+    }
+    unsigned slot = (timer->target64 >> (level * XTIMER_WHEEL_BITS)) & WHEEL_SLOT_MASK;
+
+    _link(&_wheel[level][slot], timer);
+    _occupied[level] |= (1U << slot);
+}
+
+/**
+ * @brief   Find the first occupied slot
+ *
+ * A pending slot on a lower level always starts before any pending slot on a
+ * higher level, so the first non-empty level yields the next event.
+ *
+ * @param[out] start    start time of the slot
+ * @param[out] slot     index of the slot
+ *
+ * @return  level of the slot, LEVEL_FAR for the overflow list or LEVEL_NONE
+ */
+static int _next_event(uint64_t *start, unsigned *slot)
+{
+    for (unsigned level = 0; level < XTIMER_WHEEL_LEVELS; level++) {
+        if (_occupied[level]) {
+            unsigned shift = level * XTIMER_WHEEL_BITS;
+            *slot = bitarithm_lsb(_occupied[level]);
+            *start = ((_base >> (shift + XTIMER_WHEEL_BITS)) << (shift + XTIMER_WHEEL_BITS))
+                     | ((uint64_t)*slot << shift);
+            return level;
+        }
+    }
+    if (_far_list) {
+        *start = ((_base >> WHEEL_SPAN_BITS) + 1) << WHEEL_SPAN_BITS;
+        return LEVEL_FAR;
+    }
+    return LEVEL_NONE;
+}
+
+/**
+ * @brief   Advance the wheel to @p start and re-distribute a slot's timers
+ */
+static void _cascade(int level, unsigned slot, uint64_t start)
+{
+    xtimer_t *list;
+
+    if (level == LEVEL_FAR) {
+        list = _far_list;
+        _far_list = NULL;
+    }
+    else {
+        list = _wheel[level][slot];
+        _wheel[level][slot] = NULL;
+        _occupied[level] &= ~(1U << slot);
+    }
+
+    _base = start;
+    while (list) {
+        xtimer_t *timer = list;
+        list = timer->next;
+        _insert(timer);
+    }
+}
+
+/**
+ * @brief   Cascade all higher level slots starting before the low-level timer
+ *          could be set safely
+ *
+ * Keeps the wheel's reference time close to now, so new timers are inserted
+ * relative to a current base and the next slot is never in the past.
+ */
+static void _advance(uint64_t now)
+{
+    uint64_t start;
+    unsigned slot;
+    int level;
+
+    if (!_numof) {
+        _base = now;
+        return;
+    }
+
+    while (((level = _next_event(&start, &slot)) > 0) &&
+           (start <= now + XTIMER_ISR_BACKOFF)) {
+        _cascade(level, slot, start);
+    }
+}
+
+static void _lltimer_arm(void)
+{
+    uint64_t start;
+    unsigned slot;
+    int level = _next_event(&start, &slot);
+
+    if (level == LEVEL_NONE) {
+        start = LLTIMER_IDLE;
+    }
+    else if (level == 0) {
+        start -= XTIMER_OVERHEAD;
+    }
+
+    if (start != _armed) {
+        _lltimer_set(start);
+    }
+}
+
+static void _remove(xtimer_t *timer)
+{
+    _unlink(timer);
+    timer->target64 = 0;
+    timer->cookie = 0;
+    _numof--;
+}
+
+void xtimer_init(void)
+{
+    /* initialize low-level timer */
+    timer_init(XTIMER_DEV, XTIMER_HZ, _periph_timer_callback, NULL);
+
+    /* register initial overflow tick */
+    _lltimer_set(LLTIMER_IDLE);
+}
+
+uint64_t _xtimer_now64(void)
+{
+    return _xtimer_lltimer_now64();
+}
+
+void _xtimer_set64(xtimer_t *timer, uint32_t offset, uint32_t long_offset)
+{
+    DEBUG(" _xtimer_set64() offset=%" PRIu32 " long_offset=%" PRIu32 "\n", offset, long_offset);
+
+    if (!timer->callback) {
+        DEBUG("timer_set(): timer has no callback.\n");
+        return;
+    }
+
+    const uint64_t offset64 = ((uint64_t)long_offset << 32) + offset;
+    xtimer_remove(timer);
+
+    if (offset64 < XTIMER_BACKOFF) {
+        _xtimer_spin64(offset64);
+        _shoot(timer);
+    }
+    else {
+        _xtimer_set_absolute64(timer, _xtimer_now64() + offset64);
+    }
+}
+
+void _xtimer_set(xtimer_t *timer, uint32_t offset)
+{
+    _xtimer_set64(timer, offset, 0);
+}
+
+int _xtimer_set_absolute64(xtimer_t *timer, uint64_t target)
+{
+    uint64_t now = _xtimer_now64();
+
+    unsigned state = irq_disable();
+    if (_is_set(timer)) {
+        _remove(timer);
+    }
+    timer->next = NULL;
+
+    /* see xtimer_core.c: offset must be larger than XTIMER_BACKOFF, otherwise
+     * spin until target and fire from the calling context. Targets in the
+     * past, e.g. of a late xtimer_periodic_wakeup(), fire right away, hashed
+     * against _base they would land in a slot before the wheel's reference
+     * time. */
+    if ((target <= now) || ((target - now) <= XTIMER_BACKOFF)) {
+        irq_restore(state);
+        xtimer_spin_until(target);
+        _shoot(timer);
+        return 0;
+    }
+
+    _advance(now);
+    /* _base may be up to XTIMER_ISR_BACKOFF ahead of now, a target before it
+     * is due in the current level 0 slot */
+    if (target < _base) {
+        target = _base;
+    }
+    timer->target64 = target;
+    _insert(timer);
+    _numof++;
+    _lltimer_arm();
+
+    irq_restore(state);
+
+    return 0;
+}
+
+void xtimer_remove(xtimer_t *timer)
+{
+    int state = irq_disable();
+
+    /* the low-level timer is left untouched, a spurious callback just
+     * re-arms it for the next pending slot */
+    if (_is_set(timer)) {
+        _remove(timer);
+    }
+    irq_restore(state);
+}
+
+static void _periph_timer_callback(void *arg, int chan)
+{
+    (void)arg;
+    (void)chan;
+    _timer_callback();
+}
+
+static void _timer_callback(void)
+{
+    uint64_t start;
+    unsigned slot;
+    int level;
+
+    _in_handler = 1;
+    _armed = LLTIMER_IDLE;
+
+    while ((level = _next_event(&start, &slot)) != LEVEL_NONE) {
+        if (start > _xtimer_lltimer_now64() + XTIMER_ISR_BACKOFF) {
+            break;
+        }
+
+        if (level != 0) {
+            _cascade(level, slot, start);
+            continue;
+        }
+
+        /* make sure we don't fire too early */
+        xtimer_spin_until(start);
+        _base = start;
+
+        /* callbacks may set or remove timers of this very slot, so always
+         * take the current list head */
+        xtimer_t *timer;
+        while ((timer = _wheel[0][slot]) != NULL) {
+            _remove(timer);
+            _shoot(timer);
+        }
+    }
+
+    _in_handler = 0;
+
+    /* set low level timer */
+    _lltimer_arm();
+}
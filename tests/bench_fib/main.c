@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Next hop and source route lookup benchmark for the FIB
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/fib.h"
+#include "net/ipv6/addr.h"
+#include "xtimer.h"
+
+#ifndef TEST_LOOKUPS
+#define TEST_LOOKUPS        (10000U)
+#endif
+
+#define TABLE_SIZE_MAX      (1024U)
+/* routes are distributed over that many next hops or routers */
+#define NEXT_HOP_NUMOF      (16U)
+/* routers of a source route, the destination is the last hop */
+#define SR_ROUTERS          (3U)
+#define SR_HOPS             (SR_ROUTERS + 1)
+#define LIFETIME            ((uint32_t)FIB_LIFETIME_NO_EXPIRE)
+
+static const unsigned _numof[] = { 16, 128, TABLE_SIZE_MAX };
+static const uint8_t _route_lens[] = { 48, 56, 64, 80, 96, 128 };
+
+static fib_entry_t _entries[TABLE_SIZE_MAX];
+static fib_sr_t _sr_headers[TABLE_SIZE_MAX];
+static fib_sr_entry_t _sr_pool[TABLE_SIZE_MAX * SR_HOPS];
+static fib_sr_meta_t _sr_meta = { .headers = _sr_headers,
+                                  .entry_pool = _sr_pool,
+                                  .entry_pool_size = TABLE_SIZE_MAX * SR_HOPS };
+#ifdef MODULE_FIB_RADIX
+static fib_radix_node_t _radix_nodes[FIB_RADIX_NODES_NUMOF(TABLE_SIZE_MAX +
+                                                           (TABLE_SIZE_MAX * SR_HOPS))];
+#endif
+static fib_table_t _table;
+
+/* 2001:db8:<i>:<pseudo-random>, the route to it has prefix length
+ * _route_lens[i % 6], so every route covers exactly one of these addresses */
+static unsigned _route(ipv6_addr_t *addr, uint16_t i)
+{
+    uint32_t rand = (i + 1U) * 2654435761U;
+
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+    addr->u16[2] = byteorder_htons(i);
+    for (unsigned j = 3; j < 8; j++) {
+        /* xorshift32 */
+        rand ^= rand << 13;
+        rand ^= rand >> 17;
+        rand ^= rand << 5;
+        addr->u16[j].u16 = (uint16_t)rand;
+    }
+    return _route_lens[i % sizeof(_route_lens)];
+}
+
+/* fd00::<i>, i.e. a router or next hop */
+static void _router(ipv6_addr_t *addr, uint16_t i)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->u16[0] = byteorder_htons(0xfd00);
+    addr->u16[7] = byteorder_htons(i);
+}
+
+/* 2001:db9::<i>, i.e. an address without a route */
+static void _no_route(ipv6_addr_t *addr, uint16_t i)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db9);
+    addr->u16[7] = byteorder_htons(i);
+}
+
+static void _table_init(uint8_t type, unsigned numof)
+{
+    memset(&_table, 0, sizeof(_table));
+    if (type == FIB_TABLE_TYPE_SR) {
+        _sr_meta.entry_pool_size = numof * SR_HOPS;
+        _table.data.source_routes = &_sr_meta;
+    }
+    else {
+        _table.data.entries = _entries;
+    }
+    _table.table_type = type;
+    _table.size = numof;
+#ifdef MODULE_FIB_RADIX
+    _table.radix.nodes = _radix_nodes;
+    _table.radix.nodes_numof = sizeof(_radix_nodes) / sizeof(_radix_nodes[0]);
+#endif
+    fib_init(&_table);
+}
+
+static uint32_t _ns_per_op(uint32_t start, unsigned ops)
+{
+    return (uint32_t)(((uint64_t)(xtimer_now_usec() - start) * 1000U) / ops);
+}
+
+static void _print(const char *name, unsigned numof, uint32_t add,
+                   uint32_t hit, uint32_t miss)
+{
+    printf("{ \"%s\" : %u, \"add\" : %lu, \"hit\" : %lu, \"miss\" : %lu, "
+           "\"hits_per_sec\" : %lu }\n", name, numof, (unsigned long)add,
+           (unsigned long)hit, (unsigned long)miss,
+           (unsigned long)((hit > 0) ? (1000000000UL / hit) : 0));
+}
+
+static int _bench_routes(unsigned numof)
+{
+    ipv6_addr_t addr, next_hop;
+    uint32_t start, add, hit, miss;
+    unsigned found = 0;
+
+    _table_init(FIB_TABLE_TYPE_SH, numof);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < numof; i++) {
+        unsigned len = _route(&addr, i);
+        uint32_t flags = 0;
+
+        if (len < IPV6_ADDR_BIT_LEN) {
+            ipv6_addr_t pfx;
+
+            ipv6_addr_init_prefix(&pfx, &addr, len);
+            addr = pfx;
+            flags = ((uint32_t)len << FIB_FLAG_NET_PREFIX_SHIFT);
+        }
+        _router(&next_hop, i % NEXT_HOP_NUMOF);
+        if (fib_add_entry(&_table, 0, addr.u8, sizeof(addr), flags,
+                          next_hop.u8, sizeof(next_hop), 0, LIFETIME) < 0) {
+            printf("unable to add route %u\n", i);
+            return -1;
+        }
+    }
+    add = _ns_per_op(start, numof);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        unsigned idx = (i * 7) % numof;
+        kernel_pid_t iface;
+        size_t next_hop_size = sizeof(next_hop);
+        uint32_t next_hop_flags;
+
+        _route(&addr, idx);
+        if ((fib_get_next_hop(&_table, &iface, next_hop.u8, &next_hop_size,
+                              &next_hop_flags, addr.u8, sizeof(addr),
+                              0) == 0) &&
+            (byteorder_ntohs(next_hop.u16[7]) == (idx % NEXT_HOP_NUMOF))) {
+            found++;
+        }
+    }
+    hit = _ns_per_op(start, TEST_LOOKUPS);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        kernel_pid_t iface;
+        size_t next_hop_size = sizeof(next_hop);
+        uint32_t next_hop_flags;
+
+        _no_route(&addr, i);
+        if (fib_get_next_hop(&_table, &iface, next_hop.u8, &next_hop_size,
+                             &next_hop_flags, addr.u8, sizeof(addr),
+                             0) == -EHOSTUNREACH) {
+            found++;
+        }
+    }
+    miss = _ns_per_op(start, TEST_LOOKUPS);
+    fib_deinit(&_table);
+    if (found != (2 * TEST_LOOKUPS)) {
+        printf("%u of %u lookups successful\n", found, 2 * TEST_LOOKUPS);
+        return -1;
+    }
+    _print("routes", numof, add, hit, miss);
+    return 0;
+}
+
+static int _bench_source_routes(unsigned numof)
+{
+    ipv6_addr_t addr;
+    ipv6_addr_t hops[SR_HOPS];
+    uint32_t start, add, hit, miss;
+    unsigned found = 0;
+
+    _table_init(FIB_TABLE_TYPE_SR, numof);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < numof; i++) {
+        fib_sr_t *fib_sr;
+
+        if (fib_sr_create(&_table, &fib_sr, 0, 0, LIFETIME) < 0) {
+            printf("unable to add source route %u\n", i);
+            return -1;
+        }
+        for (unsigned j = 0; j < SR_ROUTERS; j++) {
+            _router(&addr, (i + j) % NEXT_HOP_NUMOF);
+            if (fib_sr_entry_append(&_table, fib_sr, addr.u8,
+                                    sizeof(addr)) < 0) {
+                printf("unable to add hop to source route %u\n", i);
+                return -1;
+            }
+        }
+        _route(&addr, i);
+        if (fib_sr_entry_append(&_table, fib_sr, addr.u8, sizeof(addr)) < 0) {
+            printf("unable to add destination to source route %u\n", i);
+            return -1;
+        }
+    }
+    add = _ns_per_op(start, numof);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        unsigned idx = (i * 7) % numof;
+        kernel_pid_t iface;
+        uint32_t flags = 0;
+        size_t hops_numof = SR_HOPS;
+        size_t hop_size = sizeof(hops[0]);
+
+        _route(&addr, idx);
+        if ((fib_sr_get_route(&_table, addr.u8, sizeof(addr), &iface, &flags,
+                              (uint8_t *)hops, &hops_numof, &hop_size, false,
+                              NULL) == 0) &&
+            (hops_numof == SR_HOPS) &&
+            (byteorder_ntohs(hops[0].u16[7]) == (idx % NEXT_HOP_NUMOF))) {
+            found++;
+        }
+    }
+    hit = _ns_per_op(start, TEST_LOOKUPS);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        kernel_pid_t iface;
+        uint32_t flags = 0;
+        size_t hops_numof = SR_HOPS;
+        size_t hop_size = sizeof(hops[0]);
+
+        _no_route(&addr, i);
+        if (fib_sr_get_route(&_table, addr.u8, sizeof(addr), &iface, &flags,
+                             (uint8_t *)hops, &hops_numof, &hop_size, false,
+                             NULL) == -EHOSTUNREACH) {
+            found++;
+        }
+    }
+    miss = _ns_per_op(start, TEST_LOOKUPS);
+    fib_deinit(&_table);
+    if (found != (2 * TEST_LOOKUPS)) {
+        printf("%u of %u lookups successful\n", found, 2 * TEST_LOOKUPS);
+        return -1;
+    }
+    _print("source_routes", numof, add, hit, miss);
+    return 0;
+}
+
+int main(void)
+{
+    int res = 0;
+
+    printf("fib benchmark, radix index %s\n",
+#ifdef MODULE_FIB_RADIX
+           "enabled"
+#else
+           "disabled"
+#endif
+           );
+    for (unsigned i = 0; i < (sizeof(_numof) / sizeof(_numof[0])); i++) {
+        res |= _bench_routes(_numof[i]);
+    }
+    for (unsigned i = 0; i < (sizeof(_numof) / sizeof(_numof[0])); i++) {
+        res |= _bench_source_routes(_numof[i]);
+    }
+    puts(res ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"fib benchmark, radix index (enabled|disabled)")
+    for _ in range(3):
+        child.expect(r"{ \"routes\" : \d+, \"add\" : \d+, \"hit\" : \d+, "
+                     r"\"miss\" : \d+, \"hits_per_sec\" : \d+ }",
+                     timeout=120)
+    for _ in range(3):
+        child.expect(r"{ \"source_routes\" : \d+, \"add\" : \d+, "
+                     r"\"hit\" : \d+, \"miss\" : \d+, \"hits_per_sec\" : \d+ }",
+                     timeout=120)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Neighbor cache and forwarding table benchmark for the IPv6
+ *              NIB
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "xtimer.h"
+
+#ifndef TEST_LOOKUPS
+#define TEST_LOOKUPS        (100000U)
+#endif
+
+#ifndef TEST_ROUTE_LOOKUPS
+#define TEST_ROUTE_LOOKUPS  (10000U)
+#endif
+
+/* routes are distributed over that many of the neighbors as next hops */
+#define NEXT_HOP_NUMOF      (16U)
+
+#define NEIGHBOR(addr, i)   _neighbor(addr, 0, i)
+#define NO_NEIGHBOR(addr)   _neighbor(addr, 1, 0)
+
+static const unsigned _numof[] = { 16, 128, GNRC_IPV6_NIB_NUMOF };
+static const unsigned _routes_numof[] = { 1000, GNRC_IPV6_NIB_OFFL_NUMOF };
+static const uint8_t _route_lens[] = { 48, 56, 64, 80, 96, 128 };
+
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_netif_t *_netif;
+
+/* 2001:db8::<ext>:ff:fe00:<i>, i.e. as derived from 6LoWPAN short addresses */
+static void _neighbor(ipv6_addr_t *addr, uint16_t ext, uint16_t i)
+{
+    memset(addr, 0, sizeof(*addr));
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+    addr->u16[4] = byteorder_htons(ext);
+    addr->u16[5] = byteorder_htons(0x00ff);
+    addr->u16[6] = byteorder_htons(0xfe00);
+    addr->u16[7] = byteorder_htons(i);
+}
+
+/* 2001:db8:<i>:<pseudo-random>, the route to it has prefix length
+ * _route_lens[i % 6], so every route covers exactly one of these addresses */
+static unsigned _route(ipv6_addr_t *addr, uint16_t i)
+{
+    uint32_t rand = (i + 1U) * 2654435761U;
+
+    addr->u16[0] = byteorder_htons(0x2001);
+    addr->u16[1] = byteorder_htons(0x0db8);
+    addr->u16[2] = byteorder_htons(i);
+    for (unsigned j = 3; j < 8; j++) {
+        /* xorshift32 */
+        rand ^= rand << 13;
+        rand ^= rand >> 17;
+        rand ^= rand << 5;
+        addr->u16[j].u16 = (uint16_t)rand;
+    }
+    return _route_lens[i % sizeof(_route_lens)];
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    (void)max_len;
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static uint32_t _ns_per_op(uint32_t start, unsigned ops)
+{
+    return (uint32_t)(((uint64_t)(xtimer_now_usec() - start) * 1000U) / ops);
+}
+
+static int _bench(unsigned from, unsigned numof)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN] = { 0x02 };
+    uint32_t start, add, hit, miss;
+    unsigned found = 0;
+
+    start = xtimer_now_usec();
+    for (unsigned i = from; i < numof; i++) {
+        NEIGHBOR(&addr, i);
+        l2addr[ETHERNET_ADDR_LEN - 1] = (uint8_t)i;
+        if (gnrc_ipv6_nib_nc_set(&addr, _netif->pid, l2addr,
+                                 sizeof(l2addr)) < 0) {
+            printf("unable to add neighbor %u\n", i);
+            return -1;
+        }
+    }
+    add = _ns_per_op(start, numof - from);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        NEIGHBOR(&addr, (i * 7) % numof);
+        if (gnrc_ipv6_nib_get_next_hop_l2addr(&addr, _netif, NULL, &nce) == 0) {
+            found++;
+        }
+    }
+    hit = _ns_per_op(start, TEST_LOOKUPS);
+    NO_NEIGHBOR(&addr);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        if (gnrc_ipv6_nib_get_next_hop_l2addr(&addr, _netif, NULL,
+                                              &nce) == -ENETUNREACH) {
+            found++;
+        }
+    }
+    miss = _ns_per_op(start, TEST_LOOKUPS);
+    if (found != (2 * TEST_LOOKUPS)) {
+        printf("%u of %u lookups successful\n", found, 2 * TEST_LOOKUPS);
+        return -1;
+    }
+    printf("{ \"entries\" : %u, \"add\" : %lu, \"hit\" : %lu, \"miss\" : %lu }\n",
+           numof, (unsigned long)add, (unsigned long)hit, (unsigned long)miss);
+    return 0;
+}
+
+static int _bench_routes(unsigned from, unsigned numof)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t addr, next_hop;
+    uint32_t start, add, hit, miss;
+    unsigned found = 0;
+
+    start = xtimer_now_usec();
+    for (unsigned i = from; i < numof; i++) {
+        unsigned len = _route(&addr, i);
+
+        NEIGHBOR(&next_hop, i % NEXT_HOP_NUMOF);
+        if (gnrc_ipv6_nib_ft_add(&addr, len, &next_hop, _netif->pid, 0) < 0) {
+            printf("unable to add route %u\n", i);
+            return -1;
+        }
+    }
+    add = _ns_per_op(start, numof - from);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_ROUTE_LOOKUPS; i++) {
+        unsigned idx = (i * 7) % numof;
+        unsigned len = _route(&addr, idx);
+
+        if ((gnrc_ipv6_nib_ft_get(&addr, NULL, &fte) == 0) &&
+            (fte.dst_len == len)) {
+            found++;
+        }
+    }
+    hit = _ns_per_op(start, TEST_ROUTE_LOOKUPS);
+    memset(&addr, 0, sizeof(addr));
+    addr.u16[0] = byteorder_htons(0x2001);
+    addr.u16[1] = byteorder_htons(0x0db9);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_ROUTE_LOOKUPS; i++) {
+        addr.u16[7] = byteorder_htons(i);
+        if (gnrc_ipv6_nib_ft_get(&addr, NULL, &fte) == -ENETUNREACH) {
+            found++;
+        }
+    }
+    miss = _ns_per_op(start, TEST_ROUTE_LOOKUPS);
+    if (found != (2 * TEST_ROUTE_LOOKUPS)) {
+        printf("%u of %u lookups successful\n", found, 2 * TEST_ROUTE_LOOKUPS);
+        return -1;
+    }
+    printf("{ \"routes\" : %u, \"add\" : %lu, \"hit\" : %lu, \"miss\" : %lu, "
+           "\"hits_per_sec\" : %lu }\n", numof, (unsigned long)add,
+           (unsigned long)hit, (unsigned long)miss,
+           (unsigned long)((hit > 0) ? (1000000000UL / hit) : 0));
+    return 0;
+}
+
+int main(void)
+{
+    unsigned numof = 0;
+    int res = 0;
+
+    printf("gnrc_ipv6_nib benchmark, hash index %s, prefix trie %s\n",
+           (GNRC_IPV6_NIB_CONF_ONL_HASH) ? "enabled" : "disabled",
+           (GNRC_IPV6_NIB_CONF_FT_TRIE) ? "enabled" : "disabled");
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    _netif = gnrc_netif_ethernet_create(_netif_stack, sizeof(_netif_stack),
+                                        GNRC_NETIF_PRIO, "eth",
+                                        &_netdev.netdev);
+    for (unsigned i = 0; i < (sizeof(_numof) / sizeof(_numof[0])); i++) {
+        res |= _bench(numof, _numof[i]);
+        numof = _numof[i];
+    }
+    numof = 0;
+    for (unsigned i = 0; i < (sizeof(_routes_numof) / sizeof(_routes_numof[0]));
+         i++) {
+        res |= _bench_routes(numof, _routes_numof[i]);
+        numof = _routes_numof[i];
+    }
+    puts(res ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Demultiplexing benchmark for gnrc_netreg
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_LOOKUPS
+#define TEST_LOOKUPS        (100000U)
+#endif
+
+#define ENTRIES_NUMOF       (512U)
+#define PORT(i)             (1024U + ((i) * 37U))
+#define PORT_UNUSED         (1023U)
+
+static gnrc_netreg_entry_t _entries[ENTRIES_NUMOF];
+static msg_t _msg_queue[8];
+
+/* find all entries of a port as gnrc_netapi_dispatch() does */
+static unsigned _demux(uint32_t port)
+{
+    gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port);
+    int numof = gnrc_netreg_num(GNRC_NETTYPE_UDP, port);
+    unsigned found = 0;
+
+    while ((numof-- > 0) && entry) {
+        found++;
+        entry = gnrc_netreg_getnext(entry);
+    }
+    return found;
+}
+
+static uint32_t _ns_per_lookup(uint32_t start)
+{
+    return (uint32_t)(((uint64_t)(xtimer_now_usec() - start) * 1000U) /
+                      TEST_LOOKUPS);
+}
+
+static int _bench(unsigned numof)
+{
+    uint32_t start, hit, miss;
+    unsigned found = 0;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        found += _demux(PORT(i % numof));
+    }
+    hit = _ns_per_lookup(start);
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < TEST_LOOKUPS; i++) {
+        found += _demux(PORT_UNUSED);
+    }
+    miss = _ns_per_lookup(start);
+    if (found != TEST_LOOKUPS) {
+        printf("%u of %u lookups successful\n", found, TEST_LOOKUPS);
+        return -1;
+    }
+    printf("{ \"entries\" : %u, \"hit\" : %lu, \"miss\" : %lu }\n", numof,
+           (unsigned long)hit, (unsigned long)miss);
+    return 0;
+}
+
+int main(void)
+{
+    unsigned numof = 0;
+    int res = 0;
+
+    printf("gnrc_netreg benchmark, hash index %s\n",
+#ifdef MODULE_GNRC_NETREG_HASH
+           "enabled");
+#else
+           "disabled");
+#endif
+    /* only threads with a message queue may register */
+    msg_init_queue(_msg_queue, sizeof(_msg_queue) / sizeof(_msg_queue[0]));
+    for (unsigned target = 1; target <= ENTRIES_NUMOF; target *= 2) {
+        for (; numof < target; numof++) {
+            gnrc_netreg_entry_init_pid(&_entries[numof], PORT(numof),
+                                       thread_getpid());
+            gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[numof]);
+        }
+        res |= _bench(numof);
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_entries[i]);
+    }
+    puts(res ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"gnrc_netreg benchmark, hash index (enabled|disabled)")
+    for _ in range(10):
+        child.expect(r"{ \"entries\" : \d+, \"hit\" : \d+, \"miss\" : \d+ }")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
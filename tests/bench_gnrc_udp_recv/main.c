@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Receive path benchmark for GNRC, driven by the host
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netif.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "sched.h"
+#include "xtimer.h"
+
+#define TEST_PORT           (61616U)
+
+/* first byte of a datagram from the host */
+#define CMD_ECHO            'e'     /**< send the datagram back */
+#define CMD_COUNT           'c'     /**< only count the datagram */
+#define CMD_REPORT          'r'     /**< reply with the counters and reset them */
+
+static uint8_t _buf[1280];
+
+/* context switches and time spent outside of the idle thread */
+static void _stats(unsigned *schedules, uint64_t *busy)
+{
+    *schedules = 0;
+    *busy = 0;
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        thread_t *thread = (thread_t *)thread_get(i);
+
+        *schedules += sched_pidlist[i].schedules;
+        if (thread && (thread->priority != THREAD_PRIORITY_IDLE)) {
+            *busy += sched_pidlist[i].runtime_ticks;
+        }
+    }
+}
+
+static void _print_addr(void)
+{
+    gnrc_netif_t *netif = gnrc_netif_iter(NULL);
+    ipv6_addr_t addrs[GNRC_NETIF_IPV6_ADDRS_NUMOF];
+    char addr_str[IPV6_ADDR_MAX_STR_LEN];
+    int res;
+
+    /* wait for the link-local address to become valid */
+    do {
+        xtimer_usleep(100U * US_PER_MS);
+        res = gnrc_netif_ipv6_addrs_get(netif, addrs, sizeof(addrs));
+    } while (res <= 0);
+    for (unsigned i = 0; i < (res / sizeof(ipv6_addr_t)); i++) {
+        if (ipv6_addr_is_link_local(&addrs[i])) {
+            printf("address: %s\n",
+                   ipv6_addr_to_str(addr_str, &addrs[i], sizeof(addr_str)));
+        }
+    }
+}
+
+int main(void)
+{
+    const sock_udp_ep_t local = { .family = AF_INET6, .port = TEST_PORT };
+    sock_udp_t sock;
+    uint32_t count = 0;
+    unsigned schedules = 0;
+    uint64_t busy = 0;
+
+    printf("GNRC receive benchmark, run-to-completion %s\n",
+#ifdef MODULE_GNRC_NETAPI_RTC
+           "enabled");
+#else
+           "disabled");
+#endif
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("unable to create sock");
+        return 1;
+    }
+    _print_addr();
+    printf("listening on port %u\n", TEST_PORT);
+    while (1) {
+        sock_udp_ep_t remote;
+        ssize_t res = sock_udp_recv(&sock, _buf, sizeof(_buf),
+                                    SOCK_NO_TIMEOUT, &remote);
+
+        if (res < 1) {
+            continue;
+        }
+        switch (_buf[0]) {
+            case CMD_ECHO:
+                sock_udp_send(&sock, _buf, res, &remote);
+                break;
+            case CMD_COUNT:
+                if (count++ == 0) {
+                    _stats(&schedules, &busy);
+                }
+                break;
+            case CMD_REPORT: {
+                unsigned schedules_now;
+                uint64_t busy_now;
+
+                /* since the first counted datagram */
+                _stats(&schedules_now, &busy_now);
+                busy_now = xtimer_usec_from_ticks64((xtimer_ticks64_t){
+                    busy_now - busy });
+                res = snprintf((char *)_buf, sizeof(_buf), "%lu %u %lu",
+                               (unsigned long)count, schedules_now - schedules,
+                               (unsigned long)busy_now);
+                sock_udp_send(&sock, _buf, res, &remote);
+                count = 0;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return 0;
+}
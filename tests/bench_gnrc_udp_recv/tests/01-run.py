@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import statistics
+import sys
+import time
+from testrunner import run
+
+TEST_PORT = 61616
+SIZES = (16, 128, 1024)
+ECHO_NUMOF = int(os.environ.get("ECHO_NUMOF", 1000))
+COUNT_NUMOF = int(os.environ.get("COUNT_NUMOF", 20000))
+BURST = int(os.environ.get("BURST", 4))
+
+
+def echo(sock, dst, payload):
+    start = time.perf_counter()
+    sock.sendto(payload, dst)
+    try:
+        while sock.recv(2048) != payload:
+            pass
+    except socket.timeout:
+        return None
+    return (time.perf_counter() - start) * 1000000
+
+
+def bench(sock, dst, size):
+    payload = b"e" * size
+    # first one resolves the host's address
+    for _ in range(10):
+        if echo(sock, dst, payload) is not None:
+            break
+    else:
+        raise RuntimeError("node does not echo")
+    rtts = [echo(sock, dst, payload) for _ in range(ECHO_NUMOF)]
+    lost = rtts.count(None)
+    rtts = [rtt for rtt in rtts if rtt is not None]
+
+    # bursts that fit into the queues of the stack, each closed by an echo
+    payload = b"c" * size
+    start = time.perf_counter()
+    for _ in range(COUNT_NUMOF // BURST):
+        for _ in range(BURST):
+            sock.sendto(payload, dst)
+        echo(sock, dst, b"e" * size)
+    duration = time.perf_counter() - start
+    sock.sendto(b"r", dst)
+    received, switches, busy = (int(v) for v in sock.recv(64).split())
+    print('{ "payload" : %u, "rtt_median" : %u, "rtt_99" : %u, '
+          '"echo_lost" : %u, "received" : %u, "rate" : %u, '
+          '"switches" : %.2f, "busy" : %.1f }' %
+          (size, statistics.median(rtts),
+           sorted(rtts)[(len(rtts) * 99) // 100], lost, received,
+           received / duration, switches / received, busy / received))
+
+
+def testfunc(child):
+    child.expect(r"GNRC receive benchmark, run-to-completion (enabled|disabled)")
+    child.expect(r"address: (fe80::[0-9a-f:]+)")
+    addr = child.match.group(1)
+    child.expect_exact("listening on port {}".format(TEST_PORT))
+    iface = os.environ.get("PORT", "tap0")
+    dst = (addr, TEST_PORT, 0, socket.if_nametoindex(iface))
+    with socket.socket(socket.AF_INET6, socket.SOCK_DGRAM) as sock:
+        sock.settimeout(0.2)
+        for size in SIZES:
+            bench(sock, dst, size)
+    print("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
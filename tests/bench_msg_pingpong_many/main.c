@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure messages send per second in batches
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include "thread.h"
+
+#include "msg.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#define BATCH_MAX           (32U)
+
+volatile unsigned _flag = 0;
+static char _stack[THREAD_STACKSIZE_MAIN];
+static msg_t _queue[BATCH_MAX];
+
+static const unsigned _batches[] = { 1, 8, BATCH_MAX };
+
+static void _timer_callback(void*arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void *_second_thread(void *arg)
+{
+    (void)arg;
+    msg_t test[BATCH_MAX];
+
+    msg_init_queue(_queue, BATCH_MAX);
+
+    while(1) {
+        msg_receive_many(test, BATCH_MAX);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    printf("main starting\n");
+
+    kernel_pid_t other = thread_create(_stack,
+                                       sizeof(_stack),
+                                       (THREAD_PRIORITY_MAIN - 1),
+                                       THREAD_CREATE_STACKTEST,
+                                       _second_thread,
+                                       NULL,
+                                       "second_thread");
+
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    msg_t test[BATCH_MAX];
+
+    for (unsigned i = 0; i < sizeof(_batches) / sizeof(_batches[0]); i++) {
+        uint32_t n = 0;
+
+        _flag = 0;
+        xtimer_set(&timer, TEST_DURATION);
+        while(!_flag) {
+            msg_send_many(test, _batches[i], other);
+            n += _batches[i];
+        }
+
+        printf("{ \"batch\" : %u, \"result\" : %"PRIu32" }\n", _batches[i], n);
+    }
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for batch in (1, 8, 32):
+        child.expect(r"{ \"batch\" : %d, \"result\" : \d+ }" % batch)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       UDP throughput over the native TAP interface
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc/netif.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "shell.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define RX_IDLE_TIMEOUT     (US_PER_SEC)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static uint8_t _buf[1500];
+
+static void _print_result(const char *dir, uint32_t pkts, uint32_t bytes,
+                          uint32_t usec)
+{
+    if (usec == 0) {
+        usec = 1;
+    }
+    printf("%s: %" PRIu32 " packets, %" PRIu32 " bytes in %" PRIu32 " us "
+           "--- %" PRIu32 " pkt/s, %" PRIu32 " B/s\n", dir, pkts, bytes, usec,
+           (uint32_t)(((uint64_t)pkts * US_PER_SEC) / usec),
+           (uint32_t)(((uint64_t)bytes * US_PER_SEC) / usec));
+}
+
+static int _rx(int argc, char **argv)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+    uint32_t pkts = 0, bytes = 0;
+    uint32_t start = 0, last = 0, duration;
+    ssize_t res;
+
+    if (argc < 3) {
+        printf("usage: %s <port> <seconds>\n", argv[0]);
+        return 1;
+    }
+    local.port = atoi(argv[1]);
+    duration = atoi(argv[2]) * US_PER_SEC;
+
+    if (sock_udp_create(&sock, &local, NULL, 0) < 0) {
+        puts("Error: unable to create UDP sock");
+        return 1;
+    }
+
+    /* wait for the first packet, then count until the duration elapsed */
+    while (((res = sock_udp_recv(&sock, _buf, sizeof(_buf),
+                                 pkts ? RX_IDLE_TIMEOUT : SOCK_NO_TIMEOUT,
+                                 NULL)) >= 0) || (res == -ENOBUFS)) {
+        last = xtimer_now_usec();
+        if (pkts++ == 0) {
+            start = last;
+        }
+        if (res > 0) {
+            bytes += res;
+        }
+        if ((last - start) >= duration) {
+            break;
+        }
+    }
+    sock_udp_close(&sock);
+
+    _print_result("rx", pkts, bytes, last - start);
+    return 0;
+}
+
+static int _tx(int argc, char **argv)
+{
+    sock_udp_ep_t remote = { .family = AF_INET6 };
+    uint32_t pkts = 0, bytes = 0, errors = 0;
+    uint32_t start, now, duration;
+    size_t len;
+    int iface;
+
+    if (argc < 5) {
+        printf("usage: %s <addr> <port> <payload length> <seconds>\n", argv[0]);
+        return 1;
+    }
+    iface = ipv6_addr_split_iface(argv[1]);
+    if ((iface < 0) && (gnrc_netif_numof() == 1)) {
+        iface = gnrc_netif_iter(NULL)->pid;
+    }
+    if (ipv6_addr_from_str((ipv6_addr_t *)&remote.addr.ipv6, argv[1]) == NULL) {
+        puts("Error: unable to parse destination address");
+        return 1;
+    }
+    remote.netif = (iface < 0) ? SOCK_ADDR_ANY_NETIF : (uint16_t)iface;
+    remote.port = atoi(argv[2]);
+    len = atoi(argv[3]);
+    duration = atoi(argv[4]) * US_PER_SEC;
+    if (len > sizeof(_buf)) {
+        len = sizeof(_buf);
+    }
+    memset(_buf, 'x', len);
+
+    start = xtimer_now_usec();
+    do {
+        if (sock_udp_send(NULL, _buf, len, &remote) < 0) {
+            /* packet buffer full, let the stack catch up */
+            errors++;
+            thread_yield();
+        }
+        else {
+            pkts++;
+            bytes += len;
+        }
+        now = xtimer_now_usec();
+    } while ((now - start) < duration);
+
+    _print_result("tx", pkts, bytes, now - start);
+    printf("tx: %" PRIu32 " send errors\n", errors);
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "rx", "measure UDP receive throughput", _rx },
+    { "tx", "measure UDP send throughput", _tx },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("UDP throughput benchmark over TAP");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+import threading
+import time
+
+from testrunner import run
+
+
+RX_PORT = 8808
+TX_PORT = 8809
+PAYLOAD = b"x" * 64
+DURATION = 1
+RX_RATE = int(os.environ.get("RX_RATE", 10000))   # packets per second
+
+
+def _blast(addr, ifindex, stop):
+    s = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+    start = time.time()
+    sent = 0
+    while not stop.is_set():
+        # an unlimited rate just measures how the stack copes with overload
+        if sent > (time.time() - start) * RX_RATE:
+            continue
+        try:
+            s.sendto(PAYLOAD, (addr, RX_PORT, 0, ifindex))
+            sent += 1
+        except OSError:
+            # host socket buffer full
+            time.sleep(0.0001)
+    s.close()
+
+
+def testfunc(child):
+    tap = os.environ.get("TAP", "tap0")
+    ifindex = socket.if_nametoindex(tap)
+
+    child.expect_exact("UDP throughput benchmark over TAP")
+    child.sendline("ifconfig")
+    child.expect(r"inet6 addr: (fe80::[0-9a-f:]+)\s+scope: local")
+    addr = child.match.group(1)
+
+    child.sendline("rx {} {}".format(RX_PORT, DURATION))
+    stop = threading.Event()
+    blaster = threading.Thread(target=_blast, args=(addr, ifindex, stop))
+    blaster.start()
+    try:
+        child.expect(r"rx: (\d+) packets, (\d+) bytes in \d+ us --- "
+                     r"(\d+) pkt/s, \d+ B/s", timeout=DURATION + 10)
+    finally:
+        stop.set()
+        blaster.join()
+    assert int(child.match.group(1)) > 0
+    print("rx: {} pkt/s".format(child.match.group(3)))
+
+    child.sendline("tx ff02::1 {} {} {}".format(TX_PORT, len(PAYLOAD),
+                                                DURATION))
+    child.expect(r"tx: (\d+) packets, (\d+) bytes in \d+ us --- "
+                 r"(\d+) pkt/s, \d+ B/s", timeout=DURATION + 10)
+    assert int(child.match.group(1)) > 0
+    print("tx: {} pkt/s".format(child.match.group(3)))
+    child.expect(r"tx: \d+ send errors")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
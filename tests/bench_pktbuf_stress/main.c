@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer throughput and fragmentation benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#ifndef CHURN_WINDOW
+#define CHURN_WINDOW        (12U)
+#endif
+
+#ifndef CHURN_MAX_SIZE
+#define CHURN_MAX_SIZE      (640U)
+#endif
+
+#define NETIF_HDR_SIZE      (24U)
+#define IPV6_HDR_SIZE       (40U)
+#define UDP_HDR_SIZE        (8U)
+
+static volatile unsigned _flag = 0;
+static uint32_t _seed = 1;
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static void _start(xtimer_t *timer)
+{
+    _flag = 0;
+    timer->callback = _timer_callback;
+    xtimer_set(timer, TEST_DURATION);
+}
+
+/* deterministic, so all implementations see the same sizes */
+static unsigned _rand(unsigned min, unsigned max)
+{
+    _seed = (_seed * 1103515245U) + 12345U;
+    return min + ((_seed >> 16) % (max - min + 1));
+}
+
+static void _rx(void)
+{
+    xtimer_t timer;
+    uint32_t count = 0;
+
+    _start(&timer);
+    while (!_flag) {
+        gnrc_pktsnip_t *netif = gnrc_pktbuf_add(NULL, NULL, NETIF_HDR_SIZE,
+                                                GNRC_NETTYPE_NETIF);
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(netif, NULL, _rand(64, 1280),
+                                              GNRC_NETTYPE_UNDEF);
+
+        if ((netif == NULL) || (pkt == NULL)) {
+            puts("rx: allocation failed");
+            return;
+        }
+        gnrc_pktbuf_mark(pkt, IPV6_HDR_SIZE, GNRC_NETTYPE_UNDEF);
+        gnrc_pktbuf_mark(pkt, UDP_HDR_SIZE, GNRC_NETTYPE_UNDEF);
+        gnrc_pktbuf_release(pkt);
+        count++;
+    }
+    printf("{ \"test\" : \"rx\", \"result\" : %"PRIu32" }\n", count);
+}
+
+static void _tx(void)
+{
+    static const unsigned hdrs[] = { UDP_HDR_SIZE, IPV6_HDR_SIZE, NETIF_HDR_SIZE };
+    xtimer_t timer;
+    uint32_t count = 0;
+
+    _start(&timer);
+    while (!_flag) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, _rand(8, 1232),
+                                              GNRC_NETTYPE_UNDEF);
+
+        for (unsigned i = 0; (pkt != NULL) && (i < sizeof(hdrs) / sizeof(hdrs[0])); i++) {
+            gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, NULL, hdrs[i],
+                                                  GNRC_NETTYPE_UNDEF);
+            if (hdr == NULL) {
+                gnrc_pktbuf_release(pkt);
+            }
+            pkt = hdr;
+        }
+        if (pkt == NULL) {
+            puts("tx: allocation failed");
+            return;
+        }
+        gnrc_pktbuf_release(pkt);
+        count++;
+    }
+    printf("{ \"test\" : \"tx\", \"result\" : %"PRIu32" }\n", count);
+}
+
+static gnrc_pktsnip_t *_churn_pkt(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, _rand(8, CHURN_MAX_SIZE),
+                                          GNRC_NETTYPE_UNDEF);
+
+    if (pkt != NULL) {
+        gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, NULL, IPV6_HDR_SIZE,
+                                              GNRC_NETTYPE_UNDEF);
+        if (hdr == NULL) {
+            gnrc_pktbuf_release(pkt);
+        }
+        pkt = hdr;
+    }
+    return pkt;
+}
+
+static void _churn(void)
+{
+    gnrc_pktsnip_t *live[CHURN_WINDOW] = { NULL };
+    xtimer_t timer;
+    uint32_t steps = 0, failures = 0;
+    unsigned low = 0, high = GNRC_PKTBUF_SIZE;
+
+    _start(&timer);
+    while (!_flag) {
+        unsigned i = _rand(0, CHURN_WINDOW - 1);
+
+        gnrc_pktbuf_release(live[i]);
+        live[i] = _churn_pkt();
+        if (live[i] == NULL) {
+            failures++;
+        }
+        steps++;
+    }
+
+    /* find the largest packet that fits besides the live ones */
+    while (low < high) {
+        unsigned size = (low + high + 1) / 2;
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size,
+                                              GNRC_NETTYPE_UNDEF);
+        if (pkt != NULL) {
+            gnrc_pktbuf_release(pkt);
+            low = size;
+        }
+        else {
+            high = size - 1;
+        }
+    }
+
+    for (unsigned i = 0; i < CHURN_WINDOW; i++) {
+        gnrc_pktbuf_release(live[i]);
+    }
+
+    printf("{ \"test\" : \"churn\", \"result\" : %"PRIu32", "
+           "\"failures\" : %"PRIu32", \"largest\" : %u }\n",
+           steps, failures, low);
+}
+
+int main(void)
+{
+    puts("packet buffer stress benchmark");
+
+    gnrc_pktbuf_init();
+    _rx();
+    _tx();
+    _churn();
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
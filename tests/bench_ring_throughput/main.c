@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure ring buffer throughput in bytes per second
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ringbuffer.h"
+#include "spsc_ring.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#ifndef RING_SIZE
+#define RING_SIZE           (256U)
+#endif
+
+#define CHUNK_MAX           (100U)
+
+typedef unsigned (*round_t)(unsigned chunk);
+
+static volatile unsigned _flag = 0;
+static char _ring_buf[RING_SIZE];
+static char _in[CHUNK_MAX];
+static char _out[CHUNK_MAX];
+static tsrb_t _tsrb;
+static ringbuffer_t _rb;
+
+static const unsigned _chunks[] = { 1, 10, 100 };
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static unsigned _add_one(unsigned chunk)
+{
+    for (unsigned i = 0; i < chunk; i++) {
+        tsrb_add_one(&_tsrb, _in[i]);
+    }
+    for (unsigned i = 0; i < chunk; i++) {
+        _out[i] = tsrb_get_one(&_tsrb);
+    }
+    return chunk;
+}
+
+static unsigned _tsrb_bulk(unsigned chunk)
+{
+    tsrb_add(&_tsrb, _in, chunk);
+    return tsrb_get(&_tsrb, _out, chunk);
+}
+
+static unsigned _ringbuffer_bulk(unsigned chunk)
+{
+    ringbuffer_add(&_rb, _in, chunk);
+    return ringbuffer_get(&_rb, _out, chunk);
+}
+
+static unsigned _zerocopy(unsigned chunk)
+{
+    unsigned len;
+    unsigned done = 0;
+
+    while (done < chunk) {
+        char *span = spsc_ring_reserve(&_tsrb, &len);
+        if (len > chunk - done) {
+            len = chunk - done;
+        }
+        memset(span, done, len);
+        spsc_ring_commit(&_tsrb, len);
+        done += len;
+    }
+
+    done = 0;
+    while (done < chunk) {
+        const char *span = spsc_ring_peek(&_tsrb, &len);
+        _out[0] = span[len - 1];
+        spsc_ring_consume(&_tsrb, len);
+        done += len;
+    }
+    return done;
+}
+
+static void _run(const char *name, round_t round)
+{
+    xtimer_t timer = { .callback = _timer_callback };
+
+    for (unsigned i = 0; i < sizeof(_chunks) / sizeof(_chunks[0]); i++) {
+        uint32_t bytes = 0;
+
+        tsrb_init(&_tsrb, _ring_buf, sizeof(_ring_buf));
+        ringbuffer_init(&_rb, _ring_buf, sizeof(_ring_buf));
+
+        _flag = 0;
+        xtimer_set(&timer, TEST_DURATION);
+        while (!_flag) {
+            bytes += round(_chunks[i]);
+        }
+
+        printf("{ \"op\" : \"%s\", \"chunk\" : %u, \"result\" : %"PRIu32" }\n",
+               name, _chunks[i], bytes);
+    }
+}
+
+int main(void)
+{
+    memset(_in, 'x', sizeof(_in));
+
+    _run("add_one", _add_one);
+    _run("tsrb", _tsrb_bulk);
+    _run("ringbuffer", _ringbuffer_bulk);
+    _run("zerocopy", _zerocopy);
+
+    puts("[SUCCESS]");
+    return 0;
+}
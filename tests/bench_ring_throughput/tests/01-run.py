@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for op in ("add_one", "tsrb", "ringbuffer", "zerocopy"):
+        for chunk in (1, 10, 100):
+            child.expect(r"{ \"op\" : \"%s\", \"chunk\" : %d, \"result\" : \d+ }"
+                         % (op, chunk))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -39,13 +39,21 @@
 #include "thread.h"
 
 
-#define P(NAME) printf("    tcb->%-11s            %3u     %3u\n", #NAME, \
+#define P(NAME) used += sizeof(((thread_t *) 0)->NAME); \
+                printf("    tcb->%-16s       %3u     %3u\n", #NAME, \
                        (unsigned)sizeof(((thread_t *) 0)->NAME), \
                        (unsigned)offsetof(thread_t, NAME))
 
 int main(void)
 {
+    size_t used = 0;
+
     puts("Sizeof RIOT core types\n");
+#ifdef MODULE_CORE_COMPACT_LAYOUT
+    puts("compact layout: enabled\n");
+#else
+    puts("compact layout: disabled\n");
+#endif
 
     puts("                                size");
 
@@ -109,6 +117,30 @@ int main(void)
     P(name);
     P(stack_size);
 #endif
+#ifdef MODULE_CORE_SCHED_EDF
+    P(edf_period);
+    P(edf_rel_deadline);
+    P(edf_release);
+    P(edf_deadline);
+#endif
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    P(base_priority);
+    P(pi_blocked_on);
+    P(pi_mutexes);
+#endif
+#ifdef USE_LAZY_FPU_CONTEXT
+    P(fpucontext);
+#endif
+#ifdef HAVE_THREAD_ARCH_T
+    P(arch);
+#endif
+    printf("padding in thread_t:            %3u\n",
+           (unsigned)(sizeof(thread_t) - used));
+#ifdef MODULE_CORE_MSG
+    printf("padding in msg_t:               %3u\n",
+           (unsigned)(sizeof(msg_t) - sizeof(kernel_pid_t) - sizeof(uint16_t)
+                      - sizeof(((msg_t *) 0)->content)));
+#endif
 
     puts("\n[SUCCESS]");
     return 0;
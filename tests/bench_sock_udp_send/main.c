@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Send path throughput benchmark for sock_udp
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "iolist.h"
+#include "net/ethernet.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev_test.h"
+#include "net/sock/udp.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000U)
+#endif
+
+#define TEST_PORT           (61616U)
+
+static const uint8_t _l2addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const size_t _sizes[] = { 16, 128, 1024 };
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static uint8_t _payload[1024];
+static volatile unsigned _flag = 0;
+static uint32_t _frames;
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+
+    _frames++;
+    return (int)iolist_size(iolist);
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+
+    if (max_len < sizeof(_l2addr)) {
+        return -EOVERFLOW;
+    }
+    memcpy(value, _l2addr, sizeof(_l2addr));
+    return sizeof(_l2addr);
+}
+
+static void _init_interface(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_send_cb(&_dev, _netdev_send);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    gnrc_netif_ethernet_create(_netif_stack, sizeof(_netif_stack),
+                               GNRC_NETIF_PRIO, "dummy_netif",
+                               (netdev_t *)&_dev);
+    xtimer_usleep(500); /* wait for thread to start */
+}
+
+static void _timer_callback(void *arg)
+{
+    (void)arg;
+
+    _flag = 1;
+}
+
+static int _bench(size_t size)
+{
+    /* ff02::1, needs no address resolution */
+    const sock_udp_ep_t remote = { .addr = { .ipv6 = { 0xff, 0x02, 0, 0, 0, 0,
+                                                       0, 0, 0, 0, 0, 0,
+                                                       0, 0, 0, 0x01 } },
+                                   .family = AF_INET6,
+                                   .port = TEST_PORT };
+    xtimer_t timer = { .callback = _timer_callback };
+    uint32_t count = 0;
+
+    _frames = 0;
+    _flag = 0;
+    xtimer_set(&timer, TEST_DURATION);
+    while (!_flag) {
+        if (sock_udp_send(NULL, _payload, size, &remote) < 0) {
+            printf("sending %u bytes failed\n", (unsigned)size);
+            xtimer_remove(&timer);
+            return -1;
+        }
+        count++;
+    }
+    if (_frames != count) {
+        printf("%lu datagrams sent, but %lu frames\n", (unsigned long)count,
+               (unsigned long)_frames);
+        return -1;
+    }
+    printf("{ \"payload\" : %u, \"result\" : %lu }\n", (unsigned)size,
+           (unsigned long)count);
+    return 0;
+}
+
+int main(void)
+{
+    int res = 0;
+
+    printf("sock_udp_send benchmark, headroom %s\n",
+#ifdef MODULE_GNRC_PKTBUF_HEADROOM
+           "enabled");
+#else
+           "disabled");
+#endif
+    _init_interface();
+    for (unsigned i = 0; i < sizeof(_sizes) / sizeof(_sizes[0]); i++) {
+        res |= _bench(_sizes[i]);
+    }
+    puts(res ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}
@@ -98,8 +98,13 @@ extern "C" {
 /* Longest timer timeout tested (TUT ticks)*/
 /* Reduce this if RAM usage is too high */
 #ifndef TEST_MAX
+#if TEST_XTIMER
+/* XTIMER_ISR_BACKOFF may be larger than 128 ticks (e.g. on native) */
+#define TEST_MAX ((XTIMER_ISR_BACKOFF) + 127)
+#else
 #define TEST_MAX 128
 #endif
+#endif
 /* Shortest timer timeout tested (TUT ticks) */
 #ifndef TEST_MIN
 #if TEST_XTIMER
@@ -123,7 +128,7 @@ extern "C" {
 #endif
 #endif
 /* Number of test values */
-#define TEST_NUM ((TEST_MAX) - (TEST_MIN) + 1)
+#define TEST_NUM ((TEST_MAX) - (TEST_MIN) + 1U)
 /* 2-logarithm of TEST_NUM, not possible to compute automatically by the
  * preprocessor unless comparing values like this */
 #if TEST_NUM <=     (1 <<  2)
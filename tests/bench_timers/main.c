@@ -426,9 +426,17 @@ static void run_test(test_ctx_t *ctx, uint32_t interval, unsigned int variant)
             _xtimer_set(&xt, interval);
             break;
         case TEST_XTIMER_SET_ABSOLUTE:
+#ifdef TIMER_64BIT_HW
+            {
+                uint64_t now64 = _xtimer_now64();
+                ctx->target_tut = (uint32_t)now64 + interval;
+                _xtimer_set_absolute64(&xt, now64 + interval);
+            }
+#else
             now = READ_TUT();
             ctx->target_tut = now + interval;
             _xtimer_set_absolute(&xt, ctx->target_tut);
+#endif
             break;
         case TEST_XTIMER_PERIODIC_WAKEUP:
             _xtimer_periodic_wakeup(&now, interval);
@@ -710,6 +718,7 @@ int main(void)
         }
 
     }
+#if USE_REFERENCE || !(TEST_XTIMER)
     int res = timer_init(TIM_REF_DEV, TIM_REF_FREQ, cb_timer_periph, NULL);
     if (res < 0) {
         print_str("Error ");
@@ -717,6 +726,7 @@ int main(void)
         print_str(" intializing reference timer\n");
         return res;
     }
+#endif
     random_init(seed);
 
 #if !(TEST_XTIMER)
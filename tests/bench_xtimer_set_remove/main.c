@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure xtimer set/remove latency with many armed timers
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "irq.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#ifndef BENCH_PROBES_NUMOF
+#define BENCH_PROBES_NUMOF  (100U)
+#endif
+
+/* background timers are set between 10 and 100 seconds into the future so
+ * none of them fires during the benchmark */
+#define BG_OFFSET_MIN       (10UL * US_PER_SEC)
+#define BG_OFFSET_MAX       (100UL * US_PER_SEC)
+
+static const unsigned _loads[] = { 10, 100, 1000 };
+
+static xtimer_t _bg_timers[1000];
+static xtimer_t _probes[BENCH_PROBES_NUMOF];
+static uint32_t _offsets[BENCH_PROBES_NUMOF];
+
+static void _cb(void *arg)
+{
+    (void)arg;
+    puts("error: timer fired during benchmark");
+}
+
+static void _arm_background(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        _bg_timers[i].callback = _cb;
+        xtimer_set(&_bg_timers[i], random_uint32_range(BG_OFFSET_MIN,
+                                                       BG_OFFSET_MAX));
+    }
+}
+
+static void _remove_background(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        xtimer_remove(&_bg_timers[i]);
+    }
+}
+
+static void _print(const char *name, unsigned load, uint32_t time)
+{
+    printf("%14s (%4u armed): %7" PRIu32 "us --- %5" PRIu32 "ns per call\n",
+           name, load, time, (uint32_t)(((uint64_t)time * 1000) / BENCH_RUNS));
+}
+
+int main(void)
+{
+    puts("xtimer set/remove latency benchmark\n");
+
+    for (unsigned i = 0; i < BENCH_PROBES_NUMOF; i++) {
+        _offsets[i] = random_uint32_range(BG_OFFSET_MIN, BG_OFFSET_MAX);
+        _probes[i].callback = _cb;
+    }
+
+    for (unsigned l = 0; l < sizeof(_loads) / sizeof(_loads[0]); l++) {
+        unsigned load = _loads[l];
+        uint32_t t_set = 0;
+        uint32_t t_remove = 0;
+        uint32_t t_reset;
+
+        _arm_background(load);
+
+        /* probes are set and removed in batches, so the timestamps taken
+         * around each batch don't dominate the result */
+        unsigned state = irq_disable();
+        for (unsigned long i = 0; i < BENCH_RUNS; i += BENCH_PROBES_NUMOF) {
+            uint32_t start = xtimer_now_usec();
+            for (unsigned p = 0; p < BENCH_PROBES_NUMOF; p++) {
+                xtimer_set(&_probes[p], _offsets[p]);
+            }
+            uint32_t mid = xtimer_now_usec();
+            for (unsigned p = 0; p < BENCH_PROBES_NUMOF; p++) {
+                xtimer_remove(&_probes[p]);
+            }
+            t_set += mid - start;
+            t_remove += xtimer_now_usec() - mid;
+        }
+
+        /* re-setting an armed timer implies removing it first */
+        for (unsigned p = 0; p < BENCH_PROBES_NUMOF; p++) {
+            xtimer_set(&_probes[p], _offsets[p]);
+        }
+        t_reset = xtimer_now_usec();
+        for (unsigned long i = 0; i < BENCH_RUNS; i++) {
+            unsigned p = i % BENCH_PROBES_NUMOF;
+            xtimer_set(&_probes[p], _offsets[(p + 1) % BENCH_PROBES_NUMOF]);
+        }
+        t_reset = xtimer_now_usec() - t_reset;
+        for (unsigned p = 0; p < BENCH_PROBES_NUMOF; p++) {
+            xtimer_remove(&_probes[p]);
+        }
+        irq_restore(state);
+
+        _remove_background(load);
+
+        _print("xtimer_set", load, t_set);
+        _print("xtimer_remove", load, t_remove);
+        _print("xtimer re-set", load, t_reset);
+        puts("");
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 60
+BENCHMARK_REGEXP = r"\s*{func}\s+\(\s*{load} armed\):\s+\d+us\s+---\s+\d+ns per call"
+
+
+def testfunc(child):
+    child.expect_exact('xtimer set/remove latency benchmark')
+    for load in (10, 100, 1000):
+        child.expect(BENCHMARK_REGEXP.format(func="xtimer_set", load=load),
+                     timeout=TIMEOUT)
+        child.expect(BENCHMARK_REGEXP.format(func="xtimer_remove", load=load))
+        child.expect(BENCHMARK_REGEXP.format(func="xtimer re-set", load=load),
+                     timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests budgeted receive polling of network interfaces
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "embUnit.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev_test.h"
+#include "thread.h"
+#include "xtimer.h"
+
+/* lower than main, so the test can raise bursts of interrupts before the
+ * interface thread gets to serve them */
+#define NETIF_PRIO          (THREAD_PRIORITY_MAIN + 1)
+#define SETTLE_US           (10U * US_PER_MS)
+#define BURST_NUMOF         ((2 * GNRC_NETIF_RX_BUDGET) + 8)
+
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _dev;
+static gnrc_netif_t *_netif;
+static xtimer_t _timer;
+static volatile unsigned _pending;
+static volatile unsigned _received;
+
+static int _netif_send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    (void)netif;
+    gnrc_pktbuf_release(pkt);
+    return -ENOTSUP;
+}
+
+static gnrc_pktsnip_t *_netif_recv(gnrc_netif_t *netif)
+{
+    (void)netif;
+    _received++;
+    return NULL;
+}
+
+static const gnrc_netif_ops_t _netif_ops = {
+    .send = _netif_send,
+    .recv = _netif_recv,
+    .get = gnrc_netif_get_from_netdev,
+    .set = gnrc_netif_set_from_netdev,
+};
+
+/* behaves like a device with a single frame buffer: one frame per interrupt,
+ * the next frame raises the next interrupt */
+static void _netdev_isr(netdev_t *dev)
+{
+    if (_pending > 0) {
+        _pending--;
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+    if (_pending > 0) {
+        dev->event_callback(dev, NETDEV_EVENT_ISR);
+    }
+}
+
+static int _get_netdev_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    (void)max_len;
+    *((uint16_t *)value) = NETDEV_TYPE_TEST;
+    return sizeof(uint16_t);
+}
+
+static void _raise_isr(void *arg)
+{
+    (void)arg;
+    _dev.netdev.event_callback(&_dev.netdev, NETDEV_EVENT_ISR);
+}
+
+static void _reset(void)
+{
+    xtimer_usleep(SETTLE_US);
+    _pending = 0;
+    _received = 0;
+    _netif->poll.events = 0;
+    _netif->poll.polls = 0;
+    _netif->poll.frames = 0;
+    _netif->poll.budget_exhausted = 0;
+    _netif->poll.queue_drops = 0;
+}
+
+static void test_poll__single(void)
+{
+    _reset();
+    _pending = 1;
+    _raise_isr(NULL);
+    xtimer_usleep(SETTLE_US);
+    TEST_ASSERT_EQUAL_INT(1, _received);
+    TEST_ASSERT_EQUAL_INT(1, _netif->poll.events);
+    TEST_ASSERT_EQUAL_INT(1, _netif->poll.polls);
+    TEST_ASSERT_EQUAL_INT(1, _netif->poll.frames);
+    TEST_ASSERT_EQUAL_INT(0, _netif->poll.budget_exhausted);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_POLL_IDLE, _netif->poll.state);
+}
+
+static void test_poll__coalesce_burst(void)
+{
+    _reset();
+    _pending = BURST_NUMOF;
+    /* more interrupts than the interface's message queue could hold */
+    for (unsigned i = 0; i < (2 * GNRC_NETIF_MSG_QUEUE_SIZE); i++) {
+        _raise_isr(NULL);
+    }
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_POLL_SCHEDULED, _netif->poll.state);
+    xtimer_usleep(SETTLE_US);
+    TEST_ASSERT_EQUAL_INT(BURST_NUMOF, _received);
+    TEST_ASSERT_EQUAL_INT(BURST_NUMOF, _netif->poll.frames);
+    /* BURST_NUMOF frames take two full budgets and a partial one */
+    TEST_ASSERT_EQUAL_INT(3, _netif->poll.polls);
+    TEST_ASSERT_EQUAL_INT(2, _netif->poll.budget_exhausted);
+    TEST_ASSERT_EQUAL_INT(0, _netif->poll.queue_drops);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_POLL_IDLE, _netif->poll.state);
+}
+
+static void test_poll__queue_drop(void)
+{
+    msg_t msg = { .type = 0xffff };
+
+    _reset();
+    _pending = 1;
+    /* fill up the interface's message queue, the first message is handed
+     * over to the waiting thread directly */
+    for (unsigned i = 0; i < (GNRC_NETIF_MSG_QUEUE_SIZE + 1); i++) {
+        TEST_ASSERT_EQUAL_INT(1, msg_try_send(&msg, _netif->pid));
+    }
+    /* interrupt context can't wait for room in the queue */
+    _timer.callback = _raise_isr;
+    xtimer_set(&_timer, SETTLE_US);
+    while (*((volatile uint32_t *)&_netif->poll.events) == 0) {}
+    TEST_ASSERT_EQUAL_INT(1, _netif->poll.queue_drops);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETIF_POLL_IDLE, _netif->poll.state);
+    xtimer_usleep(SETTLE_US);
+    TEST_ASSERT_EQUAL_INT(0, _received);
+    /* the next interrupt is delivered again */
+    _raise_isr(NULL);
+    xtimer_usleep(SETTLE_US);
+    TEST_ASSERT_EQUAL_INT(1, _received);
+    TEST_ASSERT_EQUAL_INT(1, _netif->poll.polls);
+}
+
+static Test *tests_gnrc_netif_poll(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_poll__single),
+        new_TestFixture(test_poll__coalesce_burst),
+        new_TestFixture(test_poll__queue_drop),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, NULL, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_isr_cb(&_dev, _netdev_isr);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_netdev_device_type);
+    _netif = gnrc_netif_create(_netif_stack, sizeof(_netif_stack), NETIF_PRIO,
+                               "poll", &_dev.netdev, &_netif_ops);
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netif_poll());
+    TESTS_END();
+    return 0;
+}
@@ -234,10 +234,23 @@ static void _test_entry(const rbuf_t *entry, unsigned exp_current_size,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_RBUF_HASH
+    for (unsigned i = 0; i < RBUF_UNITS; i++) {
+        /* discarding const qualifier since bf_isset() does not take const */
+        rbuf_t *e = (rbuf_t *)entry;
+
+        TEST_ASSERT_EQUAL_INT((i >= (exp_int_start / 8U)) &&
+                              (i <= (exp_int_end / 8U)),
+                              bf_isset(e->received, i));
+        TEST_ASSERT_EQUAL_INT(i == (exp_int_start / 8U),
+                              bf_isset(e->starts, i));
+    }
+#else
     TEST_ASSERT_NOT_NULL(entry->ints);
     TEST_ASSERT_NULL(entry->ints->next);
     TEST_ASSERT_EQUAL_INT(exp_int_start, entry->ints->start);
     TEST_ASSERT_EQUAL_INT(exp_int_end, entry->ints->end);
+#endif
 }
 
 static void _check_pktbuf(const rbuf_t *entry)
@@ -297,6 +310,7 @@ static void test_rbuf_add__success_duplicate_fragments(void)
      * fragment 3 (fragment dispatch was removed, IPHC was applied etc.). */
     _test_entry(entry, TEST_FRAGMENT4_OFFSET - TEST_FRAGMENT3_OFFSET,
                 TEST_FRAGMENT3_OFFSET, TEST_FRAGMENT4_OFFSET - 1);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_sixlowpan_frag_rbuf_stats()->duplicates);
     _check_pktbuf(entry);
 }
 
@@ -363,6 +377,7 @@ static void test_rbuf_add__full_rbuf(void)
     TEST_ASSERT_NOT_NULL(pkt);
     rbuf_add(&_test_netif_hdr.hdr, pkt, TEST_FRAGMENT1_OFFSET,
              TEST_PAGE);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_sixlowpan_frag_rbuf_stats()->evictions);
     rbuf = rbuf_array();
     for (unsigned i = 0; i < RBUF_SIZE; i++) {
         const rbuf_t *entry = &rbuf[i];
@@ -440,6 +455,7 @@ static void test_rbuf_add__overlap_lhs(void)
         }
     }
     TEST_ASSERT_EQUAL_INT(1U, rbuf_entries);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_sixlowpan_frag_rbuf_stats()->overlaps);
     _check_pktbuf(NULL);
 }
 
@@ -484,6 +500,7 @@ static void test_rbuf_add__overlap_rhs(void)
         }
     }
     TEST_ASSERT_EQUAL_INT(1U, rbuf_entries);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_sixlowpan_frag_rbuf_stats()->overlaps);
     _check_pktbuf(NULL);
 }
 
@@ -519,6 +536,7 @@ static void test_rbuf_gc__manually(void)
     rbuf_gc();
     /* reassembly buffer is now empty */
     TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    TEST_ASSERT_EQUAL_INT(1, gnrc_sixlowpan_frag_rbuf_stats()->timeouts);
     _check_pktbuf(NULL);
 }
 
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Node of a multi-hop 6LoWPAN over socket_zep for testing
+ *              fragment forwarding
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "shell.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#endif
+
+#define MAIN_QUEUE_SIZE     (8)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static int _vrb(int argc, char **argv)
+{
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        gnrc_sixlowpan_frag_vrb_reset_stats();
+        return 0;
+    }
+
+    const gnrc_sixlowpan_frag_vrb_stats_t *stats = gnrc_sixlowpan_frag_vrb_stats();
+
+    printf("vrb: %lu datagrams, %lu fragments forwarded, %lu times full\n",
+           (unsigned long)stats->datagrams, (unsigned long)stats->fragments,
+           (unsigned long)stats->full);
+#else
+    (void)argc;
+    (void)argv;
+    puts("vrb: disabled");
+#endif
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "vrb", "Show statistics of the virtual reassembly buffer [reset]", _vrb },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("6LoWPAN fragment forwarding test");
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import shlex
+import sys
+
+import pexpect
+from testrunner import run
+
+
+# the forwarder (started by the test runner) connects the source on its first
+# and the destination on its second link, the second link of the source and
+# the destination is left unconnected
+SOURCE_ZEP = "-z [::1]:17754,[::1]:17755 -z [::1]:17758,[::1]:17759"
+DESTINATION_ZEP = "-z [::1]:17757,[::1]:17756 -z [::1]:17760,[::1]:17761"
+SOURCE_ADDR = "2001:db8::a"
+DESTINATION_ADDR = "2001:db8::c"
+PING_COUNT = 5
+PING_SIZE = 1024
+
+
+def _spawn(zep):
+    args = shlex.split(zep)
+    node = pexpect.spawnu(os.environ["TERMPROG"], args, timeout=10,
+                          codec_errors="replace", echo=False)
+    node.expect_exact("6LoWPAN fragment forwarding test")
+    return node
+
+
+def _ifaces(node):
+    """returns interface ID and link-local address of both interfaces"""
+    node.sendline("ifconfig")
+    ifaces = []
+    for _ in range(2):
+        node.expect(r"Iface\s+(\d+)\s")
+        iface = node.match.group(1)
+        node.expect(r"inet6 addr: (fe80::[0-9a-f:]+)\s+scope: local")
+        ifaces.append((iface, node.match.group(1)))
+    return ifaces
+
+
+def _cmd(node, cmd):
+    node.sendline(cmd)
+    node.expect_exact("> ")
+
+
+def testfunc(child):
+    child.expect_exact("6LoWPAN fragment forwarding test")
+    source = _spawn(SOURCE_ZEP)
+    destination = _spawn(DESTINATION_ZEP)
+    try:
+        fwd_ifaces = _ifaces(child)
+        src_iface, src_ll = _ifaces(source)[0]
+        dst_iface, dst_ll = _ifaces(destination)[0]
+
+        _cmd(source, "ifconfig {} add {}/128".format(src_iface, SOURCE_ADDR))
+        _cmd(source, "nib route add {} {}/128 {}".format(
+            src_iface, DESTINATION_ADDR, fwd_ifaces[0][1]))
+        _cmd(destination, "ifconfig {} add {}/128".format(dst_iface,
+                                                          DESTINATION_ADDR))
+        _cmd(destination, "nib route add {} {}/128 {}".format(
+            dst_iface, SOURCE_ADDR, fwd_ifaces[1][1]))
+        _cmd(child, "nib route add {} {}/128 {}".format(
+            fwd_ifaces[0][0], SOURCE_ADDR, src_ll))
+        _cmd(child, "nib route add {} {}/128 {}".format(
+            fwd_ifaces[1][0], DESTINATION_ADDR, dst_ll))
+
+        source.sendline("ping6 -c {} -s {} {}".format(PING_COUNT, PING_SIZE,
+                                                      DESTINATION_ADDR))
+        source.expect(r"(\d+) packets transmitted, (\d+) packets received",
+                      timeout=PING_COUNT + 10)
+        assert int(source.match.group(2)) == PING_COUNT
+        source.expect(r"round-trip min/avg/max = [\d.]+/([\d.]+)/[\d.]+ ms")
+        print("\nping rtt avg: {} ms".format(source.match.group(1)))
+
+        child.sendline("vrb")
+        child.expect(r"vrb: (disabled|(\d+) datagrams, (\d+) fragments "
+                     r"forwarded, \d+ times full)")
+        if child.match.group(1) != "disabled":
+            # echo requests and replies are forwarded without reassembly
+            assert int(child.match.group(2)) == 2 * PING_COUNT
+            assert int(child.match.group(3)) > 2 * PING_COUNT
+        child.sendline("pktbuf")
+        child.expect(r"position of last byte used: (\d+)")
+        print("forwarder packet buffer used: {} bytes"
+              .format(child.match.group(1)))
+    finally:
+        for node in (source, destination):
+            node.terminate(force=True)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
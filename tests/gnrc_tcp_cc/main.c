@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Bulk transfer over GNRC TCP for measuring goodput on lossy links
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "xtimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static uint8_t _buf[GNRC_TCP_MSS];
+
+/* every byte of the stream is its offset, truncated to 8 bit */
+static void _fill(uint8_t *buf, size_t len, size_t offset)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(offset + i);
+    }
+}
+
+static int _tcp_recv(int argc, char **argv)
+{
+    size_t rcvd = 0, corrupted = 0, len;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    len = atoi(argv[2]);
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open_passive(&_tcb, AF_INET6, NULL, atoi(argv[1]));
+    if (res < 0) {
+        printf("tcp_recv: gnrc_tcp_open_passive() failed: %d\n", res);
+        return 1;
+    }
+    while (rcvd < len) {
+        res = gnrc_tcp_recv(&_tcb, _buf, sizeof(_buf),
+                            GNRC_TCP_CONNECTION_TIMEOUT_DURATION);
+        if (res == -EAGAIN) {
+            continue;
+        }
+        if (res < 0) {
+            printf("tcp_recv: gnrc_tcp_recv() failed: %d\n", res);
+            break;
+        }
+        for (int i = 0; i < res; i++) {
+            if (_buf[i] != (uint8_t)(rcvd + i)) {
+                corrupted++;
+            }
+        }
+        rcvd += res;
+    }
+    gnrc_tcp_close(&_tcb);
+    printf("tcp_recv: %u bytes received, %u corrupted\n", (unsigned)rcvd,
+           (unsigned)corrupted);
+    return (res < 0) ? 1 : 0;
+}
+
+static int _tcp_send(int argc, char **argv)
+{
+    size_t sent = 0, len;
+    uint32_t start, duration;
+    int res;
+
+    if (argc < 4) {
+        printf("usage: %s <addr> <port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    len = atoi(argv[3]);
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open_active(&_tcb, AF_INET6, argv[1], atoi(argv[2]), 0);
+    if (res < 0) {
+        printf("tcp_send: gnrc_tcp_open_active() failed: %d\n", res);
+        return 1;
+    }
+    start = xtimer_now_usec();
+    while (sent < len) {
+        size_t chunk = ((len - sent) < sizeof(_buf)) ? (len - sent) : sizeof(_buf);
+
+        _fill(_buf, chunk, sent);
+        res = gnrc_tcp_send(&_tcb, _buf, chunk, 0);
+        if (res < 0) {
+            printf("tcp_send: gnrc_tcp_send() failed: %d\n", res);
+            break;
+        }
+        sent += res;
+    }
+    /* gnrc_tcp_send() returns before the data is acknowledged */
+    while (_tcb.rtx_len > 0) {
+        xtimer_usleep(1000);
+    }
+    duration = xtimer_now_usec() - start;
+    gnrc_tcp_close(&_tcb);
+    printf("tcp_send: %u bytes in %lu us, goodput %lu byte/s\n", (unsigned)sent,
+           (unsigned long)duration,
+           (unsigned long)(((uint64_t)sent * US_PER_SEC) / (duration ? duration : 1)));
+    printf("tcp_send: %lu retransmits, %lu fast retransmits, "
+           "%lu recovery retransmits, %lu dup acks, cwnd %lu, ssthresh %lu\n",
+           (unsigned long)_tcb.stats.retransmits,
+           (unsigned long)_tcb.stats.fast_retransmits,
+           (unsigned long)_tcb.stats.recovery_retransmits,
+           (unsigned long)_tcb.stats.dup_acks, (unsigned long)_tcb.cwnd,
+           (unsigned long)_tcb.ssthresh);
+    return (res < 0) ? 1 : 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "tcp_recv", "Receive a bulk transfer", _tcp_recv },
+    { "tcp_send", "Send a bulk transfer and print its goodput", _tcp_send },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+    puts("GNRC TCP congestion control test");
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
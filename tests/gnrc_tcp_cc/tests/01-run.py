@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import collections
+import os
+import random
+import select
+import shlex
+import socket
+import sys
+import threading
+import time
+
+import pexpect
+from testrunner import run
+
+
+# the nodes do not talk to each other directly but to a relay that drops and
+# delays frames, comparable to netem on a tap interface
+SENDER_ZEP = ("::1", 17754)
+RECEIVER_ZEP = ("::1", 17755)
+RELAY_SENDER = ("::1", 17764)
+RELAY_RECEIVER = ("::1", 17765)
+SENDER_ADDR = "2001:db8::a"
+RECEIVER_ADDR = "2001:db8::b"
+PORT = 80
+LOSS = float(os.environ.get("LOSS", "2"))
+DELAY = float(os.environ.get("DELAY", "0"))
+TCP_BYTES = int(os.environ.get("TCP_BYTES", "16384"))
+MIN_GOODPUT = int(os.environ.get("MIN_GOODPUT", "0"))
+MAX_RETRANSMITS = int(os.environ.get("MAX_RETRANSMITS", "0"))
+
+
+class Relay(threading.Thread):
+    def __init__(self, loss, delay):
+        super().__init__(daemon=True)
+        self.loss = loss / 100
+        self.delay = delay / 1000
+        self.pending = collections.deque()
+        self.random = random.Random(0)
+        self.relayed = 0
+        self.dropped = 0
+        self.running = True
+        self.socks = {}
+        for local, remote in ((RELAY_SENDER, RECEIVER_ZEP),
+                              (RELAY_RECEIVER, SENDER_ZEP)):
+            sock = socket.socket(socket.AF_INET6, socket.SOCK_DGRAM)
+            sock.bind(local)
+            self.socks[local] = (sock, remote)
+
+    def run(self):
+        sender, receiver = (self.socks[RELAY_SENDER][0],
+                            self.socks[RELAY_RECEIVER][0])
+        while self.running:
+            timeout = 0.1
+            if self.pending:
+                timeout = max(0, min(timeout,
+                                     self.pending[0][0] - time.monotonic()))
+            readable, _, _ = select.select([sender, receiver], [], [],
+                                           timeout)
+            for sock in readable:
+                frame = sock.recv(2048)
+                if self.random.random() < self.loss:
+                    self.dropped += 1
+                    continue
+                self.relayed += 1
+                # frames from one node leave through the socket the other
+                # node is connected to
+                if sock is sender:
+                    out = (receiver, RECEIVER_ZEP)
+                else:
+                    out = (sender, SENDER_ZEP)
+                self.pending.append((time.monotonic() + self.delay, frame,
+                                     out))
+            # the delay is constant, so frames leave in the order they came
+            while self.pending and self.pending[0][0] <= time.monotonic():
+                _, frame, (sock, dst) = self.pending.popleft()
+                sock.sendto(frame, dst)
+
+    def stop(self):
+        self.running = False
+        self.join()
+        for sock, _ in self.socks.values():
+            sock.close()
+
+
+def _spawn(zep):
+    node = pexpect.spawnu(os.environ["TERMPROG"], shlex.split(zep),
+                          timeout=10, codec_errors="replace", echo=False)
+    node.expect_exact("GNRC TCP congestion control test")
+    return node
+
+
+def _iface(node):
+    """returns interface ID and link-local address of the interface"""
+    node.sendline("ifconfig")
+    node.expect(r"Iface\s+(\d+)\s")
+    iface = node.match.group(1)
+    node.expect(r"inet6 addr: (fe80::[0-9a-f:]+)\s+scope: local")
+    return iface, node.match.group(1)
+
+
+def _cmd(node, cmd):
+    node.sendline(cmd)
+    node.expect_exact("> ")
+
+
+def testfunc(child):
+    relay = Relay(LOSS, DELAY)
+    relay.start()
+    child.expect_exact("GNRC TCP congestion control test")
+    receiver = _spawn("-z [{}]:{},[{}]:{}".format(*RECEIVER_ZEP,
+                                                  *RELAY_RECEIVER))
+    try:
+        snd_iface, snd_ll = _iface(child)
+        rcv_iface, rcv_ll = _iface(receiver)
+
+        _cmd(child, "ifconfig {} add {}/128".format(snd_iface, SENDER_ADDR))
+        _cmd(child, "nib route add {} {}/128 {}".format(
+            snd_iface, RECEIVER_ADDR, rcv_ll))
+        _cmd(receiver, "ifconfig {} add {}/128".format(rcv_iface,
+                                                       RECEIVER_ADDR))
+        _cmd(receiver, "nib route add {} {}/128 {}".format(
+            rcv_iface, SENDER_ADDR, snd_ll))
+
+        receiver.sendline("tcp_recv {} {}".format(PORT, TCP_BYTES))
+        child.sendline("tcp_send {} {} {}".format(RECEIVER_ADDR, PORT,
+                                                  TCP_BYTES))
+        child.expect(r"tcp_send: (\d+) bytes in (\d+) us, goodput (\d+) "
+                     r"byte/s", timeout=120)
+        assert int(child.match.group(1)) == TCP_BYTES
+        goodput = int(child.match.group(3))
+        child.expect(r"tcp_send: (\d+) retransmits, (\d+) fast retransmits, "
+                     r"(\d+) recovery retransmits, (\d+) dup acks, "
+                     r"cwnd (\d+), ssthresh (\d+)")
+        counters = child.match.groups()
+        receiver.expect(r"tcp_recv: (\d+) bytes received, (\d+) corrupted",
+                        timeout=60)
+        assert int(receiver.match.group(1)) == TCP_BYTES
+        assert int(receiver.match.group(2)) == 0
+
+        print("\n{}% frame loss ({} of {} frames dropped), {} ms delay"
+              .format(LOSS, relay.dropped, relay.dropped + relay.relayed,
+                      DELAY))
+        print("goodput: {} byte/s".format(goodput))
+        print("{} retransmits, {} fast retransmits, {} recovery retransmits, "
+              "{} dup acks, cwnd {}, ssthresh {}".format(*counters))
+        if MIN_GOODPUT:
+            assert goodput >= MIN_GOODPUT, \
+                "goodput below {} byte/s".format(MIN_GOODPUT)
+            retransmits = sum(int(c) for c in counters[:3])
+            assert retransmits <= MAX_RETRANSMITS, \
+                "more than {} retransmits".format(MAX_RETRANSMITS)
+    finally:
+        receiver.terminate(force=True)
+        relay.stop()
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=10))
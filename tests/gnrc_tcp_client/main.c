@@ -12,6 +12,7 @@
 #include <inttypes.h>
 
 #include "thread.h"
+#include "xtimer.h"
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/netif.h"
@@ -141,6 +142,9 @@ void *cli_thread(void *arg)
                 return 0;
         }
 
+        /* Measure the bulk transfer in both directions */
+        uint32_t start = xtimer_now_usec();
+
         /* Fill buffer with a test pattern */
         for (size_t i = 0; i < sizeof(bufs[tid]); ++i){
             bufs[tid][i] = TEST_PATERN_CLI;
@@ -215,6 +219,13 @@ void *cli_thread(void *arg)
               }
         }
 
+        /* Report throughput of the data exchanged with the server */
+        uint32_t duration = xtimer_now_usec() - start;
+        if (ret >= 0 && duration > 0) {
+            printf("TID=%d : %d bytes exchanged in %"PRIu32" us, %"PRIu32" byte/s\n", tid,
+                   2 * NBYTE, duration, (uint32_t) ((2ULL * NBYTE * US_PER_SEC) / duration));
+        }
+
         /* If there was no error: Check received pattern */
         for (size_t i = 0; i < sizeof(bufs[tid]); ++i) {
             if (bufs[tid][i] != TEST_PATERN_SRV) {
@@ -12,6 +12,7 @@
 #include <inttypes.h>
 
 #include "thread.h"
+#include "xtimer.h"
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/netif.h"
@@ -123,6 +124,9 @@ void *srv_thread(void *arg)
                 return 0;
         }
 
+        /* Measure the bulk transfer from the client */
+        uint32_t start = xtimer_now_usec();
+
         /* Receive data, stop if errors were found */
         for (size_t rcvd = 0; rcvd < sizeof(bufs[tid]) && ret >= 0; rcvd += ret) {
             ret = gnrc_tcp_recv(&tcb, (void *) (bufs[tid] + rcvd), sizeof(bufs[tid]) - rcvd,
@@ -161,6 +165,13 @@ void *srv_thread(void *arg)
               }
         }
 
+        /* Report throughput of the data received from the client */
+        uint32_t duration = xtimer_now_usec() - start;
+        if (ret >= 0 && duration > 0) {
+            printf("TID=%d : %d bytes received in %"PRIu32" us, %"PRIu32" byte/s\n", tid,
+                   NBYTE, duration, (uint32_t) (((uint64_t) NBYTE * US_PER_SEC) / duration));
+        }
+
         /* Check received pattern */
        for (size_t i = 0; i < sizeof(bufs[tid]); ++i) {
              if (bufs[tid][i] != TEST_PATERN_CLI) {
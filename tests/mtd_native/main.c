@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the native MTD emulation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "board.h"
+#include "mtd.h"
+#include "mtd_native.h"
+#include "xtimer.h"
+
+#define SECTOR_SIZE     (MTD_SECTOR_SIZE)
+
+static uint8_t _buf[SECTOR_SIZE];
+static uint8_t _page[MTD_PAGE_SIZE];
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("FAILURE in line %d: %s\n", __LINE__, #cond); \
+            return 1; \
+        } \
+    } while (0)
+
+static int _all(const uint8_t *buf, uint8_t val, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (buf[i] != val) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int _test_nor(mtd_native_dev_t *dev)
+{
+    mtd_dev_t *mtd = &dev->dev;
+
+    CHECK(mtd_init(mtd) == 0);
+    mtd_native_stats_reset(dev);
+
+    /* fresh image is erased */
+    CHECK(mtd_read(mtd, _buf, 0, sizeof(_buf)) == sizeof(_buf));
+    CHECK(_all(_buf, 0xff, sizeof(_buf)));
+
+    /* programming clears bits only */
+    memset(_page, 0xf0, sizeof(_page));
+    CHECK(mtd_write(mtd, _page, MTD_PAGE_SIZE, sizeof(_page)) == sizeof(_page));
+    memset(_page, 0x3c, sizeof(_page));
+    CHECK(mtd_write(mtd, _page, MTD_PAGE_SIZE, sizeof(_page)) == sizeof(_page));
+    CHECK(mtd_read(mtd, _page, MTD_PAGE_SIZE, sizeof(_page)) == sizeof(_page));
+    CHECK(_all(_page, 0x30, sizeof(_page)));
+
+    /* neighboring pages are untouched */
+    CHECK(mtd_read(mtd, _buf, 0, sizeof(_buf)) == sizeof(_buf));
+    CHECK(_all(_buf, 0xff, MTD_PAGE_SIZE));
+    CHECK(_all(_buf + 2 * MTD_PAGE_SIZE, 0xff, sizeof(_buf) - 2 * MTD_PAGE_SIZE));
+
+    /* invalid accesses */
+    CHECK(mtd_write(mtd, _page, MTD_PAGE_SIZE / 2, sizeof(_page)) == -EOVERFLOW);
+    CHECK(mtd_erase(mtd, MTD_PAGE_SIZE, SECTOR_SIZE) == -EOVERFLOW);
+    CHECK(mtd_read(mtd, _buf, (MTD_SECTOR_NUM - 1) * SECTOR_SIZE + 1,
+                   SECTOR_SIZE) == -EOVERFLOW);
+
+    /* erase restores 0xff, count erases per sector */
+    CHECK(mtd_erase(mtd, 0, SECTOR_SIZE) == 0);
+    CHECK(mtd_read(mtd, _buf, 0, sizeof(_buf)) == sizeof(_buf));
+    CHECK(_all(_buf, 0xff, sizeof(_buf)));
+    CHECK(mtd_erase(mtd, SECTOR_SIZE, 2 * SECTOR_SIZE) == 0);
+
+    CHECK(dev->stats.reads == 4);
+    CHECK(dev->stats.writes == 2);
+    CHECK(dev->stats.write_bytes == 2 * MTD_PAGE_SIZE);
+    CHECK(dev->stats.erases == 2);
+    CHECK(dev->stats.erase_bytes == 3 * SECTOR_SIZE);
+    CHECK(dev->stats.sector_erases[0] == 1);
+    CHECK(dev->stats.sector_erases[1] == 1);
+    CHECK(dev->stats.sector_erases[2] == 1);
+    CHECK(dev->stats.sector_erases[3] == 0);
+
+    int res = mtd_power(mtd, MTD_POWER_DOWN);
+    CHECK((res == 0) || (res == -ENOTSUP));
+
+    return 0;
+}
+
+static void _bench(mtd_native_dev_t *dev)
+{
+    mtd_dev_t *mtd = &dev->dev;
+    uint32_t start, t_read, t_write, t_erase;
+    uint32_t size = MTD_SECTOR_NUM * SECTOR_SIZE;
+
+    memset(_page, 0xa5, sizeof(_page));
+
+    start = xtimer_now_usec();
+    for (uint32_t addr = 0; addr < size; addr += MTD_PAGE_SIZE) {
+        mtd_write(mtd, _page, addr, sizeof(_page));
+    }
+    t_write = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (uint32_t addr = 0; addr < size; addr += MTD_PAGE_SIZE) {
+        mtd_read(mtd, _page, addr, sizeof(_page));
+    }
+    t_read = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (uint32_t addr = 0; addr < size; addr += SECTOR_SIZE) {
+        mtd_erase(mtd, addr, SECTOR_SIZE);
+    }
+    t_erase = xtimer_now_usec() - start;
+
+    printf("%" PRIu32 " bytes: program %" PRIu32 " us, read %" PRIu32
+           " us, erase %" PRIu32 " us\n", size, t_write, t_read, t_erase);
+}
+
+int main(void)
+{
+    mtd_native_dev_t *dev = (mtd_native_dev_t *)MTD_0;
+
+    puts("native MTD emulation test");
+
+    if (_test_nor(dev)) {
+        return 1;
+    }
+    _bench(dev);
+
+    puts("[SUCCESS]");
+    return 0;
+}
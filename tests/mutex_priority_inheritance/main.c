@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test and benchmark for mutex priority inheritance
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef BENCH_DURATION
+#define BENCH_DURATION      (4UL * US_PER_SEC)
+#endif
+
+/* CPU time the low priority thread holds the mutex for */
+#ifndef HOLD_US
+#define HOLD_US             (1000U)
+#endif
+
+#ifndef MID_PERIOD_US
+#define MID_PERIOD_US       (20000U)
+#endif
+
+#ifndef MID_BUSY_US
+#define MID_BUSY_US         (10000U)
+#endif
+
+/* time stamps further apart than this mean the thread was preempted */
+#ifndef WORK_GAP
+#define WORK_GAP            (20U)
+#endif
+
+#define PRIO_HIGH           (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_MID            (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_LOW            (THREAD_PRIORITY_MAIN - 1)
+
+static char _stack_high[THREAD_STACKSIZE_MAIN];
+static char _stack_mid[THREAD_STACKSIZE_MAIN];
+static char _stack_low[THREAD_STACKSIZE_MAIN];
+
+static mutex_t _mutex_a = MUTEX_INIT;
+
+static volatile bool _running;
+static unsigned _locks;
+static uint32_t _worst;
+static uint64_t _total;
+
+static void _work(uint32_t usec)
+{
+    uint32_t last = xtimer_now_usec();
+    uint32_t done = 0;
+
+    while (done < usec) {
+        uint32_t now = xtimer_now_usec();
+        if (now - last < WORK_GAP) {
+            done += now - last;
+        }
+        last = now;
+    }
+}
+
+static void _wait_exit(kernel_pid_t pid)
+{
+    while (thread_getstatus(pid) != (int)STATUS_NOT_FOUND) {
+        xtimer_usleep(MID_PERIOD_US);
+    }
+}
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static mutex_t _mutex_b = MUTEX_INIT;
+static unsigned _failures;
+
+static void _expect(const char *what, kernel_pid_t pid, uint8_t prio)
+{
+    uint8_t is = thread_get(pid)->priority;
+
+    printf("  %-36s prio %2u (expected %2u)\n", what, is, prio);
+    if (is != prio) {
+        _failures++;
+    }
+}
+
+static void *_lock_a_unlock(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&_mutex_a);
+    mutex_unlock(&_mutex_a);
+    return NULL;
+}
+
+static void *_lock_b_unlock(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&_mutex_b);
+    mutex_unlock(&_mutex_b);
+    return NULL;
+}
+
+static void *_lock_b_then_a(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&_mutex_b);
+    mutex_lock(&_mutex_a);
+    mutex_unlock(&_mutex_a);
+    mutex_unlock(&_mutex_b);
+    return NULL;
+}
+
+static void _test_nested(void)
+{
+    kernel_pid_t me = thread_getpid();
+
+    puts("nested locks:");
+    mutex_lock(&_mutex_a);
+    mutex_lock(&_mutex_b);
+    _expect("holding A and B", me, THREAD_PRIORITY_MAIN);
+
+    kernel_pid_t high = thread_create(_stack_high, sizeof(_stack_high),
+                                      PRIO_HIGH, 0, _lock_a_unlock, NULL,
+                                      "high");
+    _expect("high waits for A", me, PRIO_HIGH);
+
+    kernel_pid_t mid = thread_create(_stack_mid, sizeof(_stack_mid),
+                                     PRIO_MID, 0, _lock_b_unlock, NULL, "mid");
+    /* mid is below main's boosted priority, let it run until it blocks */
+    xtimer_usleep(MID_PERIOD_US);
+    _expect("mid waits for B", me, PRIO_HIGH);
+
+    /* release out of order, high runs to completion right away */
+    mutex_unlock(&_mutex_a);
+    _expect("A released, mid still waits for B", me, PRIO_MID);
+
+    mutex_unlock(&_mutex_b);
+    _expect("B released", me, THREAD_PRIORITY_MAIN);
+
+    _wait_exit(high);
+    _wait_exit(mid);
+
+    puts("chained boost:");
+    mutex_lock(&_mutex_a);
+    kernel_pid_t low = thread_create(_stack_low, sizeof(_stack_low),
+                                     PRIO_LOW, 0, _lock_b_then_a, NULL,
+                                     "low");
+    _expect("low holds B and waits for A", me, PRIO_LOW);
+
+    high = thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH, 0,
+                         _lock_b_unlock, NULL, "high");
+    _expect("high waits for B, low", low, PRIO_HIGH);
+    _expect("high waits for B, main", me, PRIO_HIGH);
+
+    mutex_unlock(&_mutex_a);
+    _expect("A released", me, THREAD_PRIORITY_MAIN);
+
+    _wait_exit(low);
+    _wait_exit(high);
+
+    printf("nested locks: %s\n", _failures ? "FAILED" : "OK");
+}
+
+#define LOCK_TIMEOUT_US     (MID_PERIOD_US)
+
+static volatile int _timeout_res;
+
+static void *_lock_a_timeout(void *arg)
+{
+    (void)arg;
+
+    _timeout_res = xtimer_mutex_lock_timeout(&_mutex_a, LOCK_TIMEOUT_US);
+    if (_timeout_res == 0) {
+        mutex_unlock(&_mutex_a);
+    }
+    return NULL;
+}
+
+static void _test_timeout(void)
+{
+    kernel_pid_t me = thread_getpid();
+    unsigned failures = _failures;
+
+    puts("lock timeout:");
+    mutex_lock(&_mutex_a);
+    kernel_pid_t high = thread_create(_stack_high, sizeof(_stack_high),
+                                      PRIO_HIGH, 0, _lock_a_timeout, NULL,
+                                      "high");
+    _expect("high waits for A with timeout", me, PRIO_HIGH);
+
+    kernel_pid_t mid = thread_create(_stack_mid, sizeof(_stack_mid),
+                                     PRIO_MID, 0, _lock_a_unlock, NULL, "mid");
+    _expect("mid waits for A", me, PRIO_HIGH);
+
+    /* high gives up, main keeps the boost of the remaining waiter */
+    _wait_exit(high);
+    if (_timeout_res != -1) {
+        _failures++;
+    }
+    _expect("high timed out", me, PRIO_MID);
+
+    mutex_unlock(&_mutex_a);
+    _expect("A released", me, THREAD_PRIORITY_MAIN);
+    _wait_exit(mid);
+
+    /* the only waiter gives up, the unlock takes the fast path */
+    mutex_lock(&_mutex_a);
+    high = thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH, 0,
+                         _lock_a_timeout, NULL, "high");
+    _expect("high waits for A with timeout", me, PRIO_HIGH);
+
+    _wait_exit(high);
+    _expect("high timed out", me, THREAD_PRIORITY_MAIN);
+    if ((_timeout_res != -1) || thread_get(me)->pi_mutexes) {
+        _failures++;
+    }
+
+    mutex_unlock(&_mutex_a);
+    _expect("A released", me, THREAD_PRIORITY_MAIN);
+
+    /* the mutex is still usable by a waiter without timeout */
+    high = thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH, 0,
+                         _lock_a_timeout, NULL, "high");
+    _wait_exit(high);
+    if (_timeout_res != 0) {
+        _failures++;
+    }
+
+    printf("lock timeout: %s\n", (_failures != failures) ? "FAILED" : "OK");
+}
+#endif
+
+static void *_high(void *arg)
+{
+    (void)arg;
+
+    while (_running) {
+        /* spread the lock attempts over the medium thread's busy phase */
+        xtimer_usleep(1000 + (xtimer_now_usec() % 4000));
+
+        uint32_t start = xtimer_now_usec();
+        mutex_lock(&_mutex_a);
+        uint32_t latency = xtimer_now_usec() - start;
+        mutex_unlock(&_mutex_a);
+
+        _locks++;
+        _total += latency;
+        if (latency > _worst) {
+            _worst = latency;
+        }
+    }
+
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+
+    xtimer_ticks32_t last = xtimer_now();
+
+    while (_running) {
+        _work(MID_BUSY_US);
+        xtimer_periodic_wakeup(&last, MID_PERIOD_US);
+    }
+
+    return NULL;
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+
+    while (_running) {
+        mutex_lock(&_mutex_a);
+        _work(HOLD_US);
+        mutex_unlock(&_mutex_a);
+        /* leave some CPU time to main for stopping the benchmark */
+        xtimer_usleep(HOLD_US);
+    }
+
+    return NULL;
+}
+
+static void _bench_latency(void)
+{
+    _running = true;
+
+    kernel_pid_t low = thread_create(_stack_low, sizeof(_stack_low), PRIO_LOW,
+                                     THREAD_CREATE_WOUT_YIELD, _low, NULL,
+                                     "low");
+    kernel_pid_t mid = thread_create(_stack_mid, sizeof(_stack_mid), PRIO_MID,
+                                     THREAD_CREATE_WOUT_YIELD, _mid, NULL,
+                                     "mid");
+    kernel_pid_t high = thread_create(_stack_high, sizeof(_stack_high),
+                                      PRIO_HIGH, THREAD_CREATE_WOUT_YIELD,
+                                      _high, NULL, "high");
+
+    xtimer_usleep(BENCH_DURATION);
+    _running = false;
+
+    _wait_exit(high);
+    _wait_exit(mid);
+    _wait_exit(low);
+
+    printf("lock latency (hold %uus, medium load %uus/%uus): %u locks, "
+           "avg %luus, worst %luus\n", HOLD_US, MID_BUSY_US, MID_PERIOD_US,
+           _locks, (unsigned long)(_locks ? _total / _locks : 0),
+           (unsigned long)_worst);
+}
+
+int main(void)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    puts("mutex priority inheritance: enabled");
+    _test_nested();
+    _test_timeout();
+#else
+    puts("mutex priority inheritance: disabled");
+#endif
+
+    _bench_latency();
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    puts(_failures ? "[FAILED]" : "[SUCCESS]");
+#else
+    puts("[SUCCESS]");
+#endif
+
+    return 0;
+}
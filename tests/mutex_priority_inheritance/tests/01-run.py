@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"mutex priority inheritance: (enabled|disabled)")
+    if child.match.group(1) == "enabled":
+        child.expect_exact("nested locks: OK")
+        child.expect_exact("lock timeout: OK")
+    child.expect(r"lock latency \(.*\): \d+ locks, avg \d+us, worst \d+us",
+                 timeout=30)
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test idle periods being skipped with native_virtual_time
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TIMERS_NUMOF         (5U)
+/* a timer may fire this late, time still passes while a thread runs */
+#define MAX_LATENESS_US     (2000U)
+#define SLEEP_US            (60U * US_PER_SEC)
+#define QUEUE_SIZE          (8U)
+
+/* offsets in seconds, deliberately not in deadline order */
+static const uint32_t _offset_s[TIMERS_NUMOF] = { 30, 10, 50, 20, 40 };
+
+static xtimer_t _timers[TIMERS_NUMOF];
+static msg_t _msgs[TIMERS_NUMOF];
+static msg_t _queue[QUEUE_SIZE];
+
+int main(void)
+{
+    unsigned failures = 0;
+    uint64_t start = xtimer_now_usec64();
+    uint64_t last = 0;
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+
+    puts("native virtual time");
+
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        _msgs[i].content.value = i;
+        xtimer_set_msg(&_timers[i], _offset_s[i] * US_PER_SEC, &_msgs[i],
+                       thread_getpid());
+    }
+
+    for (unsigned n = 0; n < TIMERS_NUMOF; n++) {
+        msg_t m;
+
+        msg_receive(&m);
+        uint64_t now = xtimer_now_usec64();
+        unsigned i = m.content.value;
+        uint64_t target = start + (uint64_t)_offset_s[i] * US_PER_SEC;
+
+        printf("timer %u (%2" PRIu32 " s) fired at %" PRIu64 " us\n",
+               i, _offset_s[i], now - start);
+        if ((now < target) || (now - target > MAX_LATENESS_US)) {
+            printf("timer %u: expected at %" PRIu64 " us\n", i,
+                   target - start);
+            failures++;
+        }
+        if (target < last) {
+            printf("timer %u: fired out of order\n", i);
+            failures++;
+        }
+        last = target;
+    }
+
+    start = xtimer_now_usec64();
+    xtimer_usleep(SLEEP_US);
+    uint64_t slept = xtimer_now_usec64() - start;
+    printf("slept %" PRIu64 " us\n", slept);
+    if ((slept < SLEEP_US) || (slept - SLEEP_US > MAX_LATENESS_US)) {
+        failures++;
+    }
+
+    puts(failures ? "[FAILED]" : "[SUCCESS]");
+
+    return 0;
+}
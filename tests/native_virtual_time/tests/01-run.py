@@ -0,0 +1,36 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import time
+from testrunner import run
+
+
+# the test covers 110 s of virtual time
+MAX_WALL_TIME = float(os.environ.get("MAX_WALL_TIME", 10))
+TIMERS = [(1, 10), (3, 20), (0, 30), (4, 40), (2, 50)]
+
+
+def testfunc(child):
+    child.expect_exact("native virtual time")
+    start = time.time()
+    for idx, offset in TIMERS:
+        child.expect(r"timer {} \(\s*{} s\) fired at (\d+) us".format(idx,
+                                                                     offset))
+        assert int(child.match.group(1)) >= offset * 1000000
+    child.expect(r"slept (\d+) us")
+    assert int(child.match.group(1)) >= 60 * 1000000
+    child.expect_exact("[SUCCESS]")
+    elapsed = time.time() - start
+    print("110 s of virtual time took {:.3f} s".format(elapsed))
+    assert elapsed < MAX_WALL_TIME
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare worst-case response times of EDF and static priorities
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "sched.h"
+#include "sched_edf.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef BENCH_DURATION
+#define BENCH_DURATION      (8UL * US_PER_SEC)
+#endif
+
+typedef struct {
+    const char *name;
+    uint32_t period;
+    uint32_t deadline;
+    uint32_t wcet;
+    unsigned jobs;
+    unsigned misses;
+    uint32_t worst;
+    kernel_pid_t pid;
+} task_t;
+
+static task_t _tasks[] = {
+    { .name = "A", .period = 200000, .deadline = 200000, .wcet = 40000 },
+    { .name = "B", .period = 400000, .deadline = 80000, .wcet = 60000 },
+};
+
+#define TASKS_NUMOF         (sizeof(_tasks) / sizeof(_tasks[0]))
+
+static char _stacks[TASKS_NUMOF][THREAD_STACKSIZE_MAIN];
+static volatile bool _running;
+/* the task that executed last, tells preemption from host stalls */
+static volatile const task_t *_owner;
+static xtimer_ticks32_t _release;
+
+static void _work(const task_t *task, uint32_t usec)
+{
+    uint32_t last = xtimer_now_usec();
+    uint32_t done = 0;
+
+    _owner = task;
+    while (done < usec) {
+        uint32_t now = xtimer_now_usec();
+        /* time another task ran doesn't count as work. Time the host
+         * didn't run native at all does, that doesn't happen on hardware. */
+        if (_owner == task) {
+            done += now - last;
+        }
+        _owner = task;
+        last = now;
+    }
+}
+
+static void _account(task_t *task, uint32_t release)
+{
+    uint32_t response = xtimer_now_usec() - release;
+
+    task->jobs++;
+    if (response > task->worst) {
+        task->worst = response;
+    }
+    if (response > task->deadline) {
+        task->misses++;
+    }
+}
+
+static void *_static_task(void *arg)
+{
+    task_t *task = arg;
+    xtimer_ticks32_t last = _release;
+
+    while (_running) {
+        _work(task, task->wcet);
+        _account(task, xtimer_usec_from_ticks(last));
+        xtimer_periodic_wakeup(&last, task->period);
+    }
+
+    return NULL;
+}
+
+static void *_edf_task(void *arg)
+{
+    task_t *task = arg;
+    thread_t *me = (thread_t *)sched_active_thread;
+
+    while (_running) {
+        uint32_t release = me->edf_release;
+        _work(task, task->wcet);
+        _account(task, release);
+        thread_edf_wait_period();
+    }
+
+    return NULL;
+}
+
+static void _run(bool edf)
+{
+    _running = true;
+    /* release the first jobs of all tasks at once, the worst case for
+     * static priorities */
+    _release = xtimer_now();
+
+    for (unsigned i = 0; i < TASKS_NUMOF; i++) {
+        task_t *task = &_tasks[i];
+
+        task->jobs = 0;
+        task->misses = 0;
+        task->worst = 0;
+        if (edf) {
+            task->pid = thread_create_edf(_stacks[i], sizeof(_stacks[i]),
+                                          task->period, task->deadline,
+                                          THREAD_CREATE_WOUT_YIELD,
+                                          _edf_task, task, task->name);
+        }
+        else {
+            /* rate monotonic: the shorter the period, the higher the priority */
+            task->pid = thread_create(_stacks[i], sizeof(_stacks[i]),
+                                      THREAD_PRIORITY_MAIN - TASKS_NUMOF + i,
+                                      THREAD_CREATE_WOUT_YIELD,
+                                      _static_task, task, task->name);
+        }
+    }
+
+    xtimer_usleep(BENCH_DURATION);
+    _running = false;
+
+    for (unsigned i = 0; i < TASKS_NUMOF; i++) {
+        while (thread_getstatus(_tasks[i].pid) != (int)STATUS_NOT_FOUND) {
+            xtimer_usleep(_tasks[i].period);
+        }
+    }
+
+    for (unsigned i = 0; i < TASKS_NUMOF; i++) {
+        task_t *task = &_tasks[i];
+
+        printf("  task %s (T=%luus D=%luus C=%luus): %4u jobs, "
+               "worst response %6luus, %3u misses\n", task->name,
+               (unsigned long)task->period, (unsigned long)task->deadline,
+               (unsigned long)task->wcet, task->jobs,
+               (unsigned long)task->worst, task->misses);
+        if (edf) {
+            printf("    schedstatistics: %u deadline misses\n",
+                   sched_pidlist[task->pid].deadline_misses);
+        }
+    }
+}
+
+int main(void)
+{
+    puts("EDF scheduling benchmark");
+
+    puts("static priorities:");
+    _run(false);
+
+    puts("earliest deadline first:");
+    _run(true);
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 30
+TASK_REGEXP = (r"\s*task {name} \(T=\d+us D=\d+us C=\d+us\):\s+(\d+) jobs, "
+               r"worst response\s+\d+us,\s+(\d+) misses")
+
+
+def expect_task(child, name):
+    child.expect(TASK_REGEXP.format(name=name), timeout=TIMEOUT)
+    jobs, misses = int(child.match.group(1)), int(child.match.group(2))
+    assert jobs > 0
+    return jobs, misses
+
+
+def testfunc(child):
+    child.expect_exact('EDF scheduling benchmark')
+    child.expect_exact('static priorities:')
+    # A has the shorter period and thus the higher static priority, so every
+    # job of B completes after A's and misses its short deadline
+    assert expect_task(child, 'A')[1] == 0
+    jobs, misses = expect_task(child, 'B')
+    assert misses == jobs
+    child.expect_exact('earliest deadline first:')
+    for name in ('A', 'B'):
+        assert expect_task(child, name)[1] == 0
+        child.expect(r"\s*schedstatistics: (\d+) deadline misses")
+        assert int(child.match.group(1)) == 0
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
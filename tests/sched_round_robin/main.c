@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test time slicing between threads of the same priority
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1UL * US_PER_SEC)
+#endif
+
+#define WORKERS_NUMOF       (2U)
+
+static char _stacks[WORKERS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static volatile bool _running = true;
+static volatile unsigned _current = WORKERS_NUMOF;
+static unsigned _slices[WORKERS_NUMOF];
+static unsigned long _loops[WORKERS_NUMOF];
+
+static void *_worker(void *arg)
+{
+    unsigned idx = (unsigned)(uintptr_t)arg;
+
+    while (_running) {
+        /* the other worker ran in between, so this is a new time slice */
+        if (_current != idx) {
+            _current = idx;
+            _slices[idx]++;
+        }
+        _loops[idx]++;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("round robin scheduling test");
+
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      THREAD_CREATE_WOUT_YIELD, _worker, (void *)(uintptr_t)i,
+                      "worker");
+    }
+
+    xtimer_usleep(TEST_DURATION);
+    _running = false;
+
+    bool success = true;
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        printf("worker %u: %u slices, %lu loops\n", i, _slices[i], _loops[i]);
+        /* with a fair share, each worker gets several slices per quantum
+         * pair, a starved worker gets at most one */
+        if (_slices[i] < 2) {
+            success = false;
+        }
+    }
+    printf("quantum: %uus\n", (unsigned)SCHED_RR_QUANTUM);
+    puts(success ? "[SUCCESS]" : "[FAILED]");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 FZI Forschungszentrum Informatik
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact('round robin scheduling test')
+    for i in range(2):
+        child.expect(r'worker {}: (\d+) slices, \d+ loops'.format(i))
+        assert int(child.match.group(1)) >= 2
+    child.expect(r'quantum: \d+us')
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -35,7 +35,7 @@ static kernel_pid_t pid_add, pid_get;
 
 static void assert_avail(unsigned assumed)
 {
-    TEST_ASSERT_EQUAL_INT(assumed, rb.avail);
+    TEST_ASSERT_EQUAL_INT(assumed, spsc_ring_avail(&rb));
 }
 
 static void assert_add_one(char to_add, int assumed_result)
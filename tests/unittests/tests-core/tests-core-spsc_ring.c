@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "spsc_ring.h"
+
+#include "tests-core.h"
+
+/* not a power of two on purpose */
+#define TEST_RING_SIZE  (7)
+
+static char ring_buf[TEST_RING_SIZE];
+static spsc_ring_t ring;
+
+static void set_up(void)
+{
+    spsc_ring_init(&ring, ring_buf, sizeof(ring_buf));
+}
+
+static void test_spsc_ring_one(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, spsc_ring_get_one(&ring));
+    for (unsigned i = 0; i < TEST_RING_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, spsc_ring_put_one(&ring, (char)(0xf0 + i)));
+    }
+    TEST_ASSERT(spsc_ring_full(&ring));
+    TEST_ASSERT_EQUAL_INT(-1, spsc_ring_put_one(&ring, 0));
+    for (unsigned i = 0; i < TEST_RING_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0xf0 + i, spsc_ring_get_one(&ring));
+    }
+    TEST_ASSERT(spsc_ring_empty(&ring));
+}
+
+static void test_spsc_ring_wrap(void)
+{
+    const char data[] = "abcdefghijklmnopqrstuvwxyz";
+    char out[TEST_RING_SIZE];
+    unsigned written = 0, read = 0;
+
+    /* moves the positions around the buffer several times with chunks
+     * that are split at the end of the buffer */
+    while (read < sizeof(data)) {
+        written += spsc_ring_write(&ring, data + written,
+                                   (sizeof(data) - written < 5)
+                                   ? sizeof(data) - written : 5);
+        TEST_ASSERT_EQUAL_INT(written - read, spsc_ring_avail(&ring));
+        TEST_ASSERT_EQUAL_INT(TEST_RING_SIZE - (written - read),
+                              spsc_ring_free(&ring));
+
+        unsigned n = spsc_ring_read(&ring, out, 3);
+        TEST_ASSERT(n > 0);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(out, data + read, n));
+        read += n;
+    }
+    TEST_ASSERT_EQUAL_INT(sizeof(data), written);
+    TEST_ASSERT(spsc_ring_empty(&ring));
+}
+
+static void test_spsc_ring_write_full(void)
+{
+    const char data[] = "0123456789";
+
+    TEST_ASSERT_EQUAL_INT(TEST_RING_SIZE,
+                          spsc_ring_write(&ring, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, spsc_ring_write(&ring, data, 1));
+    TEST_ASSERT_EQUAL_INT(2, spsc_ring_consume(&ring, 2));
+    TEST_ASSERT_EQUAL_INT(2, spsc_ring_write(&ring, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(TEST_RING_SIZE, spsc_ring_consume(&ring, 100));
+}
+
+static void test_spsc_ring_copy(void)
+{
+    char out[4];
+
+    spsc_ring_write(&ring, "abcd", 4);
+    TEST_ASSERT_EQUAL_INT(4, spsc_ring_copy(&ring, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, "abcd", 4));
+    TEST_ASSERT_EQUAL_INT(4, spsc_ring_avail(&ring));
+}
+
+static void test_spsc_ring_reserve_commit(void)
+{
+    unsigned len;
+    char *span;
+
+    /* move the write position close to the end of the buffer */
+    spsc_ring_write(&ring, "xxxxx", 5);
+    spsc_ring_consume(&ring, 5);
+
+    span = spsc_ring_reserve(&ring, &len);
+    TEST_ASSERT_NOT_NULL(span);
+    TEST_ASSERT_EQUAL_INT(TEST_RING_SIZE - 5, len);
+    memcpy(span, "ab", 2);
+    spsc_ring_commit(&ring, 2);
+
+    span = spsc_ring_reserve(&ring, &len);
+    TEST_ASSERT(span == ring_buf);
+    TEST_ASSERT_EQUAL_INT(TEST_RING_SIZE - 2, len);
+    memcpy(span, "cdefg", len);
+    spsc_ring_commit(&ring, len);
+
+    TEST_ASSERT_NULL(spsc_ring_reserve(&ring, &len));
+    TEST_ASSERT_EQUAL_INT(0, len);
+    TEST_ASSERT(spsc_ring_full(&ring));
+}
+
+static void test_spsc_ring_peek_consume(void)
+{
+    unsigned len;
+    const char *span;
+
+    TEST_ASSERT_NULL(spsc_ring_peek(&ring, &len));
+    TEST_ASSERT_EQUAL_INT(0, len);
+
+    spsc_ring_write(&ring, "xxxxx", 5);
+    spsc_ring_consume(&ring, 5);
+    spsc_ring_write(&ring, "abcd", 4);
+
+    span = spsc_ring_peek(&ring, &len);
+    TEST_ASSERT_EQUAL_INT(2, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(span, "ab", 2));
+    TEST_ASSERT_EQUAL_INT(2, spsc_ring_consume(&ring, len));
+
+    span = spsc_ring_peek(&ring, &len);
+    TEST_ASSERT(span == ring_buf);
+    TEST_ASSERT_EQUAL_INT(2, len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(span, "cd", 2));
+    TEST_ASSERT_EQUAL_INT(2, spsc_ring_consume(&ring, len));
+    TEST_ASSERT(spsc_ring_empty(&ring));
+}
+
+static void test_spsc_ring_write_ahead(void)
+{
+    char buf[TEST_RING_SIZE];
+
+    spsc_ring_write(&ring, "xxxxx", 5);
+    spsc_ring_consume(&ring, 5);
+
+    TEST_ASSERT_EQUAL_INT(5, spsc_ring_write_ahead(&ring, 2, "cdefgh", 6));
+    TEST_ASSERT(spsc_ring_empty(&ring));
+    TEST_ASSERT_EQUAL_INT(2, spsc_ring_write(&ring, "ab", 2));
+    spsc_ring_commit(&ring, 5);
+    TEST_ASSERT(spsc_ring_full(&ring));
+    TEST_ASSERT_EQUAL_INT(0, spsc_ring_write_ahead(&ring, 0, "i", 1));
+
+    TEST_ASSERT_EQUAL_INT(TEST_RING_SIZE, spsc_ring_read(&ring, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(buf, "abcdefg", TEST_RING_SIZE));
+}
+
+Test *tests_core_spsc_ring_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_spsc_ring_one),
+        new_TestFixture(test_spsc_ring_wrap),
+        new_TestFixture(test_spsc_ring_write_full),
+        new_TestFixture(test_spsc_ring_copy),
+        new_TestFixture(test_spsc_ring_reserve_commit),
+        new_TestFixture(test_spsc_ring_peek_consume),
+        new_TestFixture(test_spsc_ring_write_ahead),
+    };
+
+    EMB_UNIT_TESTCALLER(core_spsc_ring_tests, set_up, NULL, fixtures);
+
+    return (Test *)&core_spsc_ring_tests;
+}
@@ -92,6 +92,13 @@ Test *tests_core_byteorder_tests(void);
  */
 Test *tests_core_ringbuffer_tests(void);
 
+/**
+ * @brief   Generates tests for spsc_ring.h
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_core_spsc_ring_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
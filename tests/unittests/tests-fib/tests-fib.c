@@ -21,11 +21,19 @@
 
 #define TEST_FIB_TABLE_SIZE (20)
 static fib_entry_t _entries[TEST_FIB_TABLE_SIZE];
+#ifdef MODULE_FIB_RADIX
+static fib_radix_node_t _radix_nodes[FIB_RADIX_NODES_NUMOF(TEST_FIB_TABLE_SIZE)];
+#endif
 static fib_table_t test_fib_table = { .data.entries = _entries,
                                       .table_type = FIB_TABLE_TYPE_SH,
                                       .size = TEST_FIB_TABLE_SIZE,
                                       .mtx_access = MUTEX_INIT,
-                                      .notify_rp_pos = 0 };
+                                      .notify_rp_pos = 0,
+#ifdef MODULE_FIB_RADIX
+                                      .radix = { .nodes = _radix_nodes,
+                                                 .nodes_numof = FIB_RADIX_NODES_NUMOF(TEST_FIB_TABLE_SIZE) },
+#endif
+                                    };
 
 /*
 * @brief helper to fill FIB with unique entries
@@ -976,6 +984,79 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief nested prefixes and a default route, lookups must find the longest
+* matching prefix, also after the middle one is removed
+*/
+static void test_fib_21_nested_prefixes(void)
+{
+    size_t add_buf_size = 16;
+    /* 2001::/16, 2001:db8::/32, 2001:db8:1::/48 and ::/0 */
+    static const uint8_t prefixes[][16] = {
+        { 0x20, 0x01 },
+        { 0x20, 0x01, 0x0d, 0xb8 },
+        { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01 },
+        { 0 },
+    };
+    static const uint32_t prefix_lens[] = { 16, 32, 48, 0 };
+    /* lookup address and the index of the prefix expected to match */
+    static const struct {
+        uint8_t addr[16];
+        uint32_t match;
+    } lookups[] = {
+        { { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, [15] = 0x01 }, 2 },
+        { { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02, [15] = 0x01 }, 1 },
+        { { 0x20, 0x01, 0x0d, 0xb9, [15] = 0x01 }, 0 },
+        { { 0x30, 0x00, [15] = 0x01 }, 3 },
+    };
+    uint8_t addr_nxt[add_buf_size];
+    uint8_t addr_nxt_hop[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    memset(addr_nxt, 0, add_buf_size);
+    for (size_t i = 0; i < (sizeof(prefixes) / sizeof(prefixes[0])); i++) {
+        /* the next hop flags identify the entry */
+        addr_nxt[15] = i + 1;
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                                               (uint8_t *)prefixes[i], add_buf_size,
+                                               (prefix_lens[i] << FIB_FLAG_NET_PREFIX_SHIFT),
+                                               addr_nxt, add_buf_size, 0x10 + i,
+                                               100000));
+    }
+
+    for (size_t i = 0; i < (sizeof(lookups) / sizeof(lookups[0])); i++) {
+        size_t nxt_size = add_buf_size;
+
+        TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                                  addr_nxt_hop, &nxt_size,
+                                                  &next_hop_flags,
+                                                  (uint8_t *)lookups[i].addr,
+                                                  add_buf_size, 0));
+        TEST_ASSERT_EQUAL_INT(0x10 + lookups[i].match, next_hop_flags);
+    }
+
+    /* without 2001:db8::/32 the 2001::/16 route is taken instead */
+    fib_remove_entry(&test_fib_table, (uint8_t *)prefixes[1], add_buf_size);
+    for (size_t i = 0; i < (sizeof(lookups) / sizeof(lookups[0])); i++) {
+        size_t nxt_size = add_buf_size;
+
+        TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                                  addr_nxt_hop, &nxt_size,
+                                                  &next_hop_flags,
+                                                  (uint8_t *)lookups[i].addr,
+                                                  add_buf_size, 0));
+        TEST_ASSERT_EQUAL_INT(0x10 + ((lookups[i].match == 1) ? 0 : lookups[i].match),
+                              next_hop_flags);
+    }
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_routes(&test_fib_table);
+    fib_print_stats(&test_fib_table);
+#endif
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1081,7 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_nested_prefixes),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
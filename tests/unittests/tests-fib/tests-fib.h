@@ -28,6 +28,11 @@ extern "C" {
 */
 void tests_fib(void);
 
+/**
+*  @brief   The entry point of this test suite without the radix index
+*/
+void tests_fib_linear(void);
+
 /**
  * @brief   Generates tests for FIB
  *
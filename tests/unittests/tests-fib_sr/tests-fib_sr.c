@@ -49,6 +49,14 @@ static fib_sr_meta_t _entries_sr = { .headers = _sr_headers,
  */
 static fib_table_t test_fib_sr_table;
 
+#ifdef MODULE_FIB_RADIX
+/**
+ * @brief the nodes of the radix index over the source routes and their hops
+ */
+static fib_radix_node_t _sr_radix_nodes[FIB_RADIX_NODES_NUMOF(TEST_MAX_FIB_SR +
+                                                              TEST_MAX_FIB_SR_ENTRIES)];
+#endif
+
 /*
  * @brief helper function to create source routes.
  *        The enrties are constructed with the given prefix and numbers
@@ -707,6 +715,10 @@ Test *tests_fib_sr_tests(void)
     test_fib_sr_table.size = TEST_MAX_FIB_SR;
     mutex_init(&(test_fib_sr_table.mtx_access));
     test_fib_sr_table.notify_rp_pos = 0;
+#ifdef MODULE_FIB_RADIX
+    test_fib_sr_table.radix.nodes = _sr_radix_nodes;
+    test_fib_sr_table.radix.nodes_numof = sizeof(_sr_radix_nodes) / sizeof(_sr_radix_nodes[0]);
+#endif
 
     fib_init(&test_fib_sr_table);
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -28,6 +28,11 @@ extern "C" {
 */
 void tests_fib_sr(void);
 
+/**
+*  @brief   The entry point of this test suite without the radix index
+*/
+void tests_fib_sr_linear(void);
+
 /**
  * @brief   Generates tests for FIB source routing
  *
@@ -178,6 +178,76 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds two routes to the forwarding table that only differ in their prefix
+ * length by one bit, the shorter one first, then tries to get an address with
+ * the same prefix as the route with the longer prefix.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns route with the longer prefix
+ */
+static void test_nib_ft_get__success5(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN - 1,
+                                                  &next_hop2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT(ipv6_addr_match_prefix(&dst, &fte.dst) >= GLOBAL_PREFIX_LEN);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+    /* we can't make any sure assumption on fte.primary */
+    TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
+}
+
+/*
+ * Adds three nested routes to the forwarding table and a fourth one diverging
+ * from them, then removes the routes from the longest prefix to the shortest,
+ * trying to get an address with the longest prefix after each removal.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the longest remaining route
+ * matching the address and -ENETUNREACH once none is left.
+ */
+static void test_nib_ft_get__success6(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const unsigned dst_lens[] = { GLOBAL_PREFIX_LEN - 8,
+                                         IPV6_ADDR_BIT_LEN,
+                                         GLOBAL_PREFIX_LEN };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t other = dst;
+
+    bf_toggle(other.u8, GLOBAL_PREFIX_LEN - 4);
+    for (unsigned i = 0; i < (sizeof(dst_lens) / sizeof(dst_lens[0])); i++) {
+        next_hop.u8[15]++;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, dst_lens[i],
+                                                      &next_hop, IFACE, 0));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&other, GLOBAL_PREFIX_LEN,
+                                                  &next_hop, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(IPV6_ADDR_BIT_LEN, fte.dst_len);
+    gnrc_ipv6_nib_ft_del(&dst, IPV6_ADDR_BIT_LEN);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN - 8, fte.dst_len);
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN - 8);
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&other, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop, &fte.next_hop));
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +797,8 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success5),
+        new_TestFixture(test_nib_ft_get__success6),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -29,6 +29,11 @@ extern "C" {
  */
 void tests_gnrc_ipv6_nib(void);
 
+/**
+ * @brief   The entry point of this test suite without the indexes of the NIB
+ */
+void tests_gnrc_ipv6_nib_linear(void);
+
 /**
  * @brief   Generates tests for internal layer
  *
@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include "tests-gnrc_ipv6_nib.h"
+
+void tests_gnrc_ipv6_nib_linear(void)
+{
+    tests_gnrc_ipv6_nib();
+}
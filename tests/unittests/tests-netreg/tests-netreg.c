@@ -139,6 +139,81 @@ void test_netreg_getnext__2_entries(void)
     TEST_ASSERT_NOT_NULL(gnrc_netreg_getnext(res));
 }
 
+/* more contexts than fit into the hash index of gnrc_netreg_hash */
+#define MANY_CTX_NUMOF      (GNRC_NETREG_HASH_SIZE + 8)
+
+static gnrc_netreg_entry_t many[2 * MANY_CTX_NUMOF];
+
+static void _register_many(void)
+{
+    for (unsigned i = 0; i < MANY_CTX_NUMOF; i++) {
+        for (unsigned j = 0; j < 2; j++) {
+            gnrc_netreg_entry_init_pid(&many[(2 * i) + j], TEST_UINT16 + i,
+                                       TEST_UINT8 + j);
+            TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                          &many[(2 * i) + j]));
+        }
+    }
+}
+
+static void test_netreg_lookup__many_entries(void)
+{
+    _register_many();
+    for (unsigned i = 0; i < MANY_CTX_NUMOF; i++) {
+        gnrc_netreg_entry_t *res;
+
+        TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                                 TEST_UINT16 + i));
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                       TEST_UINT16 + i)));
+        TEST_ASSERT_EQUAL_INT(TEST_UINT16 + i, res->demux_ctx);
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_getnext(res)));
+        TEST_ASSERT_EQUAL_INT(TEST_UINT16 + i, res->demux_ctx);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+        TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF,
+                                            TEST_UINT16 + i));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                        TEST_UINT16 + MANY_CTX_NUMOF));
+}
+
+static void test_netreg_unregister__many_entries(void)
+{
+    _register_many();
+    /* remove every other context and every second entry of the others */
+    for (unsigned i = 0; i < MANY_CTX_NUMOF; i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[2 * i]);
+        if (i & 1) {
+            gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[(2 * i) + 1]);
+        }
+    }
+    for (unsigned i = 0; i < MANY_CTX_NUMOF; i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                      TEST_UINT16 + i);
+
+        if (i & 1) {
+            TEST_ASSERT_NULL(res);
+        }
+        else {
+            TEST_ASSERT(res == &many[(2 * i) + 1]);
+            TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+        }
+    }
+    /* contexts freed up before can be registered again */
+    for (unsigned i = 1; i < MANY_CTX_NUMOF; i += 2) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST,
+                                                      &many[2 * i]));
+        TEST_ASSERT(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + i) ==
+                    &many[2 * i]);
+    }
+    for (unsigned i = 0; i < MANY_CTX_NUMOF; i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST,
+                               &many[(2 * i) + ((i & 1) ? 0 : 1)]);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                                 TEST_UINT16 + i));
+    }
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -155,6 +230,8 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_lookup__many_entries),
+        new_TestFixture(test_netreg_unregister__many_entries),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -270,6 +270,34 @@ static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 }
 #endif
 
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+static void test_pktbuf_add__fragmentation(void)
+{
+    gnrc_pktsnip_t *payloads[8], *hdrs[8], *large;
+
+    /* small headers that outlive their payloads, e.g. in a retransmission
+     * queue, do not split up the payload region */
+    for (unsigned i = 0; i < 8; i++) {
+        payloads[i] = gnrc_pktbuf_add(NULL, NULL, GNRC_PKTBUF_SIZE / 10,
+                                      GNRC_NETTYPE_TEST);
+        hdrs[i] = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(payloads[i]);
+        TEST_ASSERT_NOT_NULL(hdrs[i]);
+    }
+    for (unsigned i = 0; i < 8; i++) {
+        gnrc_pktbuf_release(payloads[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    large = gnrc_pktbuf_add(NULL, NULL, GNRC_PKTBUF_SIZE / 2, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(large);
+    gnrc_pktbuf_release(large);
+    for (unsigned i = 0; i < 8; i++) {
+        gnrc_pktbuf_release(hdrs[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 static void test_pktbuf_add__0_sized_release(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_TEST);
@@ -282,6 +310,102 @@ static void test_pktbuf_add__0_sized_release(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_add_headroom__success(void)
+{
+    gnrc_pktsnip_t *payload, *hdr1, *hdr2;
+
+    payload = gnrc_pktbuf_add_headroom(NULL, TEST_STRING16,
+                                       sizeof(TEST_STRING16),
+                                       GNRC_PKTBUF_HEADROOM(2, 48),
+                                       GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(payload);
+    hdr1 = gnrc_pktbuf_add(payload, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr1);
+    hdr2 = gnrc_pktbuf_add(hdr1, NULL, 40, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr2);
+    memset(hdr2->data, 0xff, hdr2->size);
+
+    TEST_ASSERT(hdr2->next == hdr1);
+    TEST_ASSERT(hdr1->next == payload);
+    TEST_ASSERT_NULL(payload->next);
+    TEST_ASSERT_EQUAL_INT(40, hdr2->size);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_UNDEF, hdr2->type);
+    TEST_ASSERT_EQUAL_INT(1, hdr2->users);
+    TEST_ASSERT_EQUAL_INT(8, hdr1->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING8, hdr1->data, 8));
+    TEST_ASSERT_EQUAL_INT(1, hdr1->users);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, payload->data);
+    TEST_ASSERT_EQUAL_INT(1, payload->users);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+
+    gnrc_pktbuf_release(hdr2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_add_headroom__remove_hdr(void)
+{
+    gnrc_pktsnip_t *payload, *pkt;
+
+    payload = gnrc_pktbuf_add_headroom(NULL, TEST_STRING16,
+                                       sizeof(TEST_STRING16),
+                                       GNRC_PKTBUF_HEADROOM(1, 8),
+                                       GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(payload);
+    pkt = gnrc_pktbuf_add(payload, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+
+    /* the payload outlives the header that took its headroom */
+    pkt = gnrc_pktbuf_remove_snip(pkt, pkt);
+    TEST_ASSERT(pkt == payload);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, payload->data);
+    gnrc_pktbuf_release(payload);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+#if defined(MODULE_GNRC_PKTBUF_STATIC) && defined(MODULE_GNRC_PKTBUF_HEADROOM)
+static void test_pktbuf_add_headroom__in_place(void)
+{
+    const size_t headroom = GNRC_PKTBUF_HEADROOM(1, 40);
+    gnrc_pktsnip_t *payload, *hdr1, *hdr2, *hdr3;
+    uint8_t *start;
+
+    payload = gnrc_pktbuf_add_headroom(NULL, TEST_STRING16,
+                                       sizeof(TEST_STRING16), headroom,
+                                       GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(payload);
+    start = (uint8_t *)payload - headroom;
+
+    hdr1 = gnrc_pktbuf_add(payload, NULL, 40, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr1);
+    TEST_ASSERT(((uint8_t *)hdr1 >= start) && ((void *)hdr1 < (void *)payload));
+    TEST_ASSERT(((uint8_t *)hdr1->data >= start) &&
+                (hdr1->data < (void *)payload));
+
+    /* headroom is used up */
+    hdr2 = gnrc_pktbuf_add(hdr1, NULL, 40, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr2);
+    TEST_ASSERT(((uint8_t *)hdr2 < start) || ((void *)hdr2 > (void *)payload));
+
+    /* a shared snip does not give away its headroom */
+    hdr3 = gnrc_pktbuf_add_headroom(NULL, NULL, 8, headroom, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr3);
+    gnrc_pktbuf_hold(hdr3, 1);
+    start = (uint8_t *)hdr3 - headroom;
+    hdr1 = gnrc_pktbuf_add(hdr3, NULL, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr1);
+    TEST_ASSERT(((uint8_t *)hdr1 < start) || ((void *)hdr1 > (void *)hdr3));
+
+    gnrc_pktbuf_release(hdr1);
+    gnrc_pktbuf_release(hdr3);
+    gnrc_pktbuf_release(hdr2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 static void test_pktbuf_mark__pkt_NULL__size_0(void)
 {
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(NULL, 0, GNRC_NETTYPE_TEST));
@@ -325,7 +449,8 @@ static void test_pktbuf_mark__pkt_NOT_NULL__size_greater_than_pkt_size(void)
 
 static void test_pktbuf_mark__pkt_NOT_NULL__pkt_data_NULL(void)
 {
-    gnrc_pktsnip_t pkt = { NULL, NULL, sizeof(TEST_STRING16), 1, GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .size = sizeof(TEST_STRING16), .users = 1,
+                           .type = GNRC_NETTYPE_TEST };
 
     TEST_ASSERT_NULL(gnrc_pktbuf_mark(&pkt, sizeof(TEST_STRING16) - 1,
                                       GNRC_NETTYPE_TEST));
@@ -500,6 +625,28 @@ static void test_pktbuf_mark__success_equally_sized(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_mark__realloc_remainder(void)
+{
+    uint8_t data[96];
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+    pkt = gnrc_pktbuf_add(NULL, data, sizeof(data), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 40, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, hdr->data, 40));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 30));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 40, pkt->data, 30));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 200));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 40, pkt->data, 30));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void test_pktbuf_realloc_data__size_0(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(TEST_STRING8), GNRC_NETTYPE_TEST);
@@ -713,7 +860,8 @@ static void test_pktbuf_hold__pkt_null(void)
 
 static void test_pktbuf_hold__pkt_external(void)
 {
-    gnrc_pktsnip_t pkt = { NULL, TEST_STRING8, sizeof(TEST_STRING8), 1, GNRC_NETTYPE_TEST };
+    gnrc_pktsnip_t pkt = { .data = TEST_STRING8, .size = sizeof(TEST_STRING8),
+                           .users = 1, .type = GNRC_NETTYPE_TEST };
 
     gnrc_pktbuf_hold(&pkt, 1);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
@@ -820,9 +968,10 @@ static void test_pktbuf_start_write__pkt_users_2(void)
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
 static void test_pktbuf_reverse_snips__too_full(void)
 {
-    gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
-    const size_t pkt_huge_size = GNRC_PKTBUF_SIZE - (3 * 8) -
-                                 (3 * sizeof(gnrc_pktsnip_t)) - sizeof(void*);
+    gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge, *pkt_fill;
+    /* room for three snips of 8 byte, including alignment padding */
+    const size_t pkt_huge_size = GNRC_PKTBUF_SIZE -
+                                 GNRC_PKTBUF_HEADROOM(3, 3 * 8);
 
     pkt_next = gnrc_pktbuf_add(NULL, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
     TEST_ASSERT_NOT_NULL(pkt_next);
@@ -833,6 +982,10 @@ static void test_pktbuf_reverse_snips__too_full(void)
     /* filling up rest of packet buffer */
     pkt_huge = gnrc_pktbuf_add(NULL, NULL, pkt_huge_size, GNRC_NETTYPE_UNDEF);
     TEST_ASSERT_NOT_NULL(pkt_huge);
+    /* implementations with slabs besides GNRC_PKTBUF_SIZE have room left */
+    while ((pkt_fill = gnrc_pktbuf_add(pkt_huge, NULL, 8, GNRC_NETTYPE_UNDEF))) {
+        pkt_huge = pkt_fill;
+    }
     TEST_ASSERT_NULL(gnrc_pktbuf_reverse_snips(pkt));
     gnrc_pktbuf_release(pkt_huge);
     /* release because of hold above */
@@ -876,6 +1029,14 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+        new_TestFixture(test_pktbuf_add__fragmentation),
+#endif
+        new_TestFixture(test_pktbuf_add_headroom__success),
+        new_TestFixture(test_pktbuf_add_headroom__remove_hdr),
+#if defined(MODULE_GNRC_PKTBUF_STATIC) && defined(MODULE_GNRC_PKTBUF_HEADROOM)
+        new_TestFixture(test_pktbuf_add_headroom__in_place),
+#endif
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_0),
         new_TestFixture(test_pktbuf_mark__pkt_NULL__size_not_0),
         new_TestFixture(test_pktbuf_mark__pkt_NOT_NULL__size_0),
@@ -885,6 +1046,7 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_mark__success_aligned),
         new_TestFixture(test_pktbuf_mark__success_small),
         new_TestFixture(test_pktbuf_mark__success_equally_sized),
+        new_TestFixture(test_pktbuf_mark__realloc_remainder),
         new_TestFixture(test_pktbuf_realloc_data__size_0),
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_realloc_data__memfull),
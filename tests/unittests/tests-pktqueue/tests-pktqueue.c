@@ -21,8 +21,9 @@
 #include "unittests-constants.h"
 #include "tests-pktqueue.h"
 
-#define PKT_INIT_ELEM(len, data, next) \
-    { (next), (data), (len), 1, GNRC_NETTYPE_UNDEF }
+#define PKT_INIT_ELEM(len, _data, _next) \
+    { .next = (_next), .data = (_data), .size = (len), .users = 1, \
+      .type = GNRC_NETTYPE_UNDEF }
 #define PKT_INIT_ELEM_STATIC_DATA(data, next) PKT_INIT_ELEM(sizeof(data), data, next)
 #define PKTQUEUE_INIT_ELEM(pkt) { NULL, pkt }
 
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2019 FZI Forschungszentrum Informatik
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test xtimer_wheel timers set to absolute targets in the past
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "xtimer.h"
+
+#define PERIOD_US           (10000U)
+#define PENDING_NUMOF       (4U)
+/* pending timers are set further into the future than the timers in the
+ * past, so they are stored in higher levels of the timing wheel */
+#define PENDING_OFFSET_US   (100000U)
+#define PENDING_STEP_US     (50000U)
+
+static xtimer_t _pending[PENDING_NUMOF];
+static uint64_t _pending_target[PENDING_NUMOF];
+static uint64_t _fired_at[PENDING_NUMOF];
+static unsigned _fired_order[PENDING_NUMOF];
+static volatile unsigned _fired_numof;
+static volatile unsigned _past_fired;
+static unsigned _failures;
+
+static void _past_cb(void *arg)
+{
+    (void)arg;
+    _past_fired++;
+}
+
+static void _pending_cb(void *arg)
+{
+    unsigned idx = (unsigned)(uintptr_t)arg;
+
+    _fired_at[idx] = xtimer_now_usec64();
+    _fired_order[_fired_numof++] = idx;
+}
+
+static void _check(const char *what, int ok)
+{
+    printf("%s: %s\n", what, ok ? "OK" : "FAILED");
+    if (!ok) {
+        _failures++;
+    }
+}
+
+int main(void)
+{
+    puts("xtimer_wheel targets in the past");
+
+    uint64_t now = xtimer_now_usec64();
+    for (unsigned i = 0; i < PENDING_NUMOF; i++) {
+        /* set in reverse order, so insertion order does not help */
+        unsigned idx = PENDING_NUMOF - 1 - i;
+        _pending[idx].callback = _pending_cb;
+        _pending[idx].arg = (void *)(uintptr_t)idx;
+        _pending_target[idx] = now + PENDING_OFFSET_US + idx * PENDING_STEP_US;
+        _xtimer_set_absolute64(&_pending[idx],
+                               _xtimer_ticks_from_usec64(_pending_target[idx]));
+    }
+
+    /* let the wheel advance, then set targets well before its base. This
+     * also keeps the periodic wakeup below from wrapping around 0. */
+    xtimer_usleep(6 * PERIOD_US);
+    xtimer_t past = { .callback = _past_cb };
+    uint64_t target = _xtimer_now64() - _xtimer_ticks_from_usec64(PERIOD_US);
+    _xtimer_set_absolute64(&past, target);
+    _xtimer_set_absolute64(&past, target - 1);
+    _check("timer in the past fired", _past_fired == 2);
+
+    xtimer_ticks32_t last = xtimer_now();
+    last.ticks32 -= xtimer_ticks_from_usec(5 * PERIOD_US).ticks32;
+    uint32_t before = xtimer_now_usec();
+    xtimer_periodic_wakeup(&last, PERIOD_US);
+    _check("periodic wakeup in the past",
+           (xtimer_now_usec() - before) < PERIOD_US);
+
+    while (_fired_numof < PENDING_NUMOF) {
+        xtimer_usleep(PENDING_STEP_US);
+    }
+
+    int ok = 1;
+    for (unsigned i = 0; i < PENDING_NUMOF; i++) {
+        if ((_fired_order[i] != i) || (_fired_at[i] < _pending_target[i])) {
+            printf("timer %u fired at %" PRIu64 ", target %" PRIu64 "\n",
+                   _fired_order[i], _fired_at[_fired_order[i]],
+                   _pending_target[_fired_order[i]]);
+            ok = 0;
+        }
+    }
+    _check("pending timers in order", ok);
+
+    puts(_failures ? "[FAILED]" : "[SUCCESS]");
+    return 0;
+}